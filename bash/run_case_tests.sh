@@ -0,0 +1,74 @@
+#!/usr/bin/env bash
+#
+# make test
+# (or ./bash/run_case_tests.sh, once the binaries in bin/ are built)
+#
+# Runs the cases in case_tests/ and prints one line per failure:
+#   - case_tests/tN: a tournament whose last line is the expected answer (1 = sim, 0 = não),
+#     decided by bin/tournament once with each option set in VARIANTS.
+#   - case_tests/<mode>/<case>.cmd: a shell command run from the repository root, with
+#     <case>.in on stdin when that file exists. Its stdout must match <case>.out and its
+#     exit status <case>.status (0 when there is no such file). $TMP is an empty scratch
+#     directory for each case.
+# Exits with status 1 if any case failed.
+
+cd "$(dirname "$0")/.." || exit 1
+
+# Option sets every tN case is decided with
+VARIANTS=(
+    ""
+    "--warm-start"
+    "--engine edmonds_karp"
+    "--engine dinic"
+    "--engine dinic --warm-start"
+    "--threads 1"
+    "--threads 2"
+    "--order bfs"
+    "--order rcm"
+    "--order team --engine dinic"
+)
+
+SCRATCH=$(mktemp -d)
+trap 'rm -rf "$SCRATCH"' EXIT
+
+total=0
+failed=0
+
+fail() {
+    echo "FAILED: $1"
+    failed=$((failed + 1))
+}
+
+for case_file in case_tests/t[0-9]*; do
+    [ "$(tail -n 1 "$case_file" | tr -d '[:space:]')" = 1 ] && expected="sim" || expected="não"
+    for options in "${VARIANTS[@]}"; do
+        total=$((total + 1))
+        answer=$(head -n -1 "$case_file" | ./bin/tournament $options)
+        [ "$answer" = "$expected" ] || fail "$case_file $options: '$answer', expected '$expected'"
+    done
+done
+
+for cmd_file in case_tests/*/*.cmd; do
+    [ -e "$cmd_file" ] || continue
+    case_name=${cmd_file%.cmd}
+    input=/dev/null
+    [ -e "$case_name.in" ] && input="$case_name.in"
+    expected_status=0
+    [ -e "$case_name.status" ] && expected_status=$(cat "$case_name.status")
+
+    total=$((total + 1))
+    export TMP="$SCRATCH/case"
+    rm -rf "$TMP" && mkdir -p "$TMP"
+    output=$(bash -c "$(cat "$cmd_file")" < "$input" 2> "$SCRATCH/stderr")
+    status=$?
+
+    if [ "$status" != "$expected_status" ]; then
+        fail "$case_name: exit status $status, expected $expected_status ($(head -c 200 "$SCRATCH/stderr"))"
+    elif [ "$output" != "$(cat "$case_name.out")" ]; then
+        fail "$case_name: output differs"
+        diff <(echo "$output") "$case_name.out" | head -n 10
+    fi
+done
+
+echo "$((total - failed))/$total cases passed"
+[ "$failed" -eq 0 ]
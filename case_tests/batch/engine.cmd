@@ -0,0 +1 @@
+bin/tournament --binary --batch --engine dinic < /dev/null
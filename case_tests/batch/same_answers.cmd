@@ -0,0 +1 @@
+for teams in 8 5; do bin/gen_dataset --teams $teams --rounds 3 --instances 30 --alpha 0.3 0.9 0.3 --bias -0.2 0.2 0.2 --threads 1 --seed 5 --binary --out $TMP/$teams > /dev/null; done && cat $TMP/8/*/instances.bin $TMP/5/*/instances.bin > $TMP/all.bin && diff <(bin/tournament --binary < $TMP/all.bin) <(bin/tournament --binary --batch < $TMP/all.bin) && bin/tournament --binary --batch < $TMP/all.bin | sort | uniq -c
@@ -0,0 +1 @@
+bin/tournament --binary --batch --threads 2 < /dev/null
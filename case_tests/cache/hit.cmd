@@ -0,0 +1 @@
+for run in 1 2; do head -n -1 case_tests/t8 | bin/tournament --cache $TMP/c; done; find $TMP/c -type f | wc -l
@@ -0,0 +1 @@
+for options in "" "--engine dinic" "--engine dinic --warm-start" ""; do head -n -1 case_tests/t7 | bin/tournament --cache $TMP/c $options; done; find $TMP/c -type f | wc -l
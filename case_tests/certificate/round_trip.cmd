@@ -0,0 +1 @@
+teams=$(head -n -1 case_tests/t8 | bin/tournament --certificate | sed -n "s/^certificado: \([0-9 ]*\) (.*/\1/p" | tr " " ",") && head -n -1 case_tests/t8 | bin/tournament --verify "$teams"
@@ -0,0 +1 @@
+head -n -1 case_tests/t8 | bin/tournament --verify 2,3
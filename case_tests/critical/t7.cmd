@@ -0,0 +1 @@
+head -n -1 case_tests/t7 | bin/tournament --critical
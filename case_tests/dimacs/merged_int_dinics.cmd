@@ -0,0 +1 @@
+bin/test_dimacs dinics < case_tests/dimacs/merged_int.max | head -n 1
@@ -0,0 +1 @@
+bin/test_dimacs dinics < case_tests/dimacs/wide.max | head -n 1
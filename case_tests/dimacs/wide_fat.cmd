@@ -0,0 +1 @@
+bin/test_dimacs fat < case_tests/dimacs/wide.max
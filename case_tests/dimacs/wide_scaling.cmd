@@ -0,0 +1 @@
+bin/test_dimacs scaling < case_tests/dimacs/wide.max | head -n 1
@@ -0,0 +1 @@
+bin/test_dimacs dinics 1 bfs < case_tests/dimacs/wide_source.max | head -n 1
@@ -0,0 +1 @@
+bin/test_dimacs push-relabel 2 < case_tests/dimacs/wide_source.max | head -n 1
@@ -0,0 +1 @@
+for t in case_tests/t[0-9]*; do head -n -1 $t | bin/tournament --engine auto; done
@@ -0,0 +1 @@
+head -n -1 case_tests/t7 | bin/tournament --critical --engine auto --engine-model case_tests/engine_model/dinic.txt
@@ -0,0 +1 @@
+for t in case_tests/t[0-9]*; do head -n -1 $t | bin/tournament --engine auto --engine-model case_tests/engine_model/dinic.txt --warm-start; done
@@ -0,0 +1 @@
+bin/tournament --engine auto --engine-model $TMP/none.txt < case_tests/t1
@@ -0,0 +1 @@
+bin/tournament --engine auto --engine-model case_tests/engine_model/short_line.txt < case_tests/t1
@@ -0,0 +1 @@
+bin/tournament --engine auto --engine-model case_tests/engine_model/unknown_engine.txt < case_tests/t1
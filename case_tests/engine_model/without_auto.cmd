@@ -0,0 +1 @@
+bin/tournament --engine dinic --engine-model case_tests/engine_model/dinic.txt < case_tests/t1
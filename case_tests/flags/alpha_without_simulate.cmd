@@ -0,0 +1 @@
+bin/tournament --alpha 0.3 < case_tests/t1
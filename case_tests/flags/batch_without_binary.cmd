@@ -0,0 +1 @@
+bin/tournament --batch < case_tests/t1
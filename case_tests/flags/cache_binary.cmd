@@ -0,0 +1 @@
+bin/tournament --binary --cache $TMP/c < /dev/null
@@ -0,0 +1 @@
+bin/tournament --stream --cache $TMP/c < case_tests/t1
@@ -0,0 +1 @@
+bin/tournament --certificate --min-wins < case_tests/t1
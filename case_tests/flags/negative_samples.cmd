@@ -0,0 +1 @@
+bin/tournament --simulate -5 < case_tests/t1
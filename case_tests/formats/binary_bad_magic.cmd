@@ -0,0 +1 @@
+bin/tournament --binary < case_tests/formats/bad_magic.bin
@@ -0,0 +1 @@
+bin/tournament --binary --batch < case_tests/formats/truncated.bin
@@ -0,0 +1 @@
+head -c 88 case_tests/formats/records.bin | bin/tournament && head -c 80 case_tests/formats/records.bin | bin/tournament
@@ -0,0 +1 @@
+bin/tournament < case_tests/formats/league.txt
@@ -0,0 +1 @@
+printf '1\n7\n' | bin/tournament
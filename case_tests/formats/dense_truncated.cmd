@@ -0,0 +1 @@
+head -n 3 case_tests/formats/league.txt | bin/tournament
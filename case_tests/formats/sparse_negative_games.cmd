@@ -0,0 +1 @@
+printf 'S 4\n3 3 3 0\n1\n1 4 -1\n' | bin/tournament
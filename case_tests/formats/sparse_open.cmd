@@ -0,0 +1 @@
+bin/tournament < case_tests/formats/open_sparse.txt
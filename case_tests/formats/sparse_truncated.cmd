@@ -0,0 +1 @@
+head -n 5 case_tests/formats/league_sparse.txt | bin/tournament
@@ -0,0 +1 @@
+bin/tournament < case_tests/formats/league_sparse.txt && diff <(bin/tournament --certificate < case_tests/formats/league.txt) <(bin/tournament --certificate < case_tests/formats/league_sparse.txt) && echo same certificate
@@ -0,0 +1 @@
+bin/gen_dataset --teams 6 --rounds 2 --instances 3 --alpha 0.5 0.6 0.1 --bias 0 0 0.1 --threads 2 --seed 9 --out $TMP/d --binary > /dev/null && for f in $TMP/d/*/instances.bin; do bin/tournament --binary < $f; done
@@ -0,0 +1 @@
+bin/gen_dataset --teams 6 --rounds 2 --instances 4 --alpha 0.5 0.5 0.1 --bias 0 0 0.1 --seed 3 --out $TMP/d > /dev/null && for f in $TMP/d/*/*.txt; do awk 'NR == 2 { for (i = 1; i <= NF; i++) won += $i } NR > 2 { for (i = 1; i <= NF; i++) { left += $i; if ($i > 2) over = 1 } } END { print won, left, over + 0 }' $f; done
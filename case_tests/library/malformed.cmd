@@ -0,0 +1 @@
+bin/test_library dimacs
@@ -0,0 +1 @@
+bin/test_library dimacs 2 < case_tests/dimacs/wide_source.max
@@ -0,0 +1 @@
+head -n -1 case_tests/t7 | bin/tournament --simulate 100 --alpha 1.5
@@ -0,0 +1 @@
+head -n -1 case_tests/t8 | bin/tournament --simulate 100 --seed 4 --threads 1
@@ -0,0 +1 @@
+head -n -1 case_tests/t7 | bin/tournament --simulate 500 --alpha 0.5 --seed 4 --threads 1
@@ -0,0 +1 @@
+head -n -1 case_tests/t7 | bin/tournament --simulate 200 --model random --bias 0.2 --seed 4 --threads 2
@@ -0,0 +1 @@
+bin/tournament_timer --prefilter < case_tests/t1
@@ -0,0 +1 @@
+bin/tournament_timer < case_tests/t3 > /dev/null
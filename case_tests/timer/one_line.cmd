@@ -0,0 +1 @@
+bin/tournament_timer --pipeline --warm-start < case_tests/t6 | grep -c "^[0-9.e-]*$"
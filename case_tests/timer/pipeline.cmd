@@ -0,0 +1 @@
+bin/tournament_timer --pipeline < case_tests/t1 > /dev/null
@@ -0,0 +1 @@
+bin/test_dimacs scaling --trace $TMP/t.json < case_tests/dimacs/wide_source.max | head -n 2 && awk -F'"bottleneck":' '/"augment"/ { events++; split($2, b, ","); flow += b[1] } END { printf "%d %.0f\n", events, flow }' $TMP/t.json && head -n 1 $TMP/t.json && tail -n 1 $TMP/t.json
@@ -0,0 +1 @@
+bin/test_dimacs scaling --trace $TMP/none/t.json < case_tests/dimacs/wide_source.max
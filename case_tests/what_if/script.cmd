@@ -0,0 +1 @@
+bin/tournament --what-if
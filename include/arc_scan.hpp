@@ -0,0 +1,87 @@
+#pragma once
+
+#include "graph.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+// Fills bitmasks over edges[0..count): bit i of `admissible` is set when arc i has
+// residual capacity >= min_residual, bit i of `forward` when it has capacity > 0.
+// Both arrays must hold (count + 63) / 64 words.
+// Uses an AVX2 kernel when the CPU supports it (picked once at runtime), scalar otherwise.
+void scan_arcs(const Edge* edges, int count, int min_residual, uint64_t* admissible, uint64_t* forward);
+
+// Reusable per-node masks so the path finders only do scalar work on candidate arcs
+struct ArcMasks {
+    std::vector<uint64_t> admissible = std::vector<uint64_t>(1);
+    std::vector<uint64_t> forward = std::vector<uint64_t>(1);
+
+    // Lists shorter than this are cheaper to walk arc by arc than to scan and then walk the
+    // bits, so the path finders only use the masks on the long lists of source and team nodes
+    static constexpr int MIN_DEGREE = 64;
+    static bool pays_off(int degree) {
+        return degree >= MIN_DEGREE;
+    }
+
+    // Scans the adjacency list of one node.
+    // Most nodes of a tournament network have a handful of arcs: a kernel call costs more
+    // than the scan itself there, so short lists are done inline. The AVX2 kernel reads
+    // int arcs only; lists of other capacity types take the scalar loop.
+    template <typename Cap>
+    void scan(const BasicEdgeList<Cap>& edges, long long min_residual) {
+        const int count = edges.size();
+        if (count > SHORT_LIST) {
+            if constexpr (std::is_same_v<Cap, int>) {
+                scan_long(edges, static_cast<int>(min_residual));
+            } else {
+                scan_generic(edges, min_residual);
+            }
+            return;
+        }
+        uint64_t adm = 0, fwd = 0;
+        for (int i = 0; i < count; ++i) {
+            const auto& e = edges[i];
+            adm |= uint64_t(e.capacity - e.flow >= min_residual) << i;
+            fwd |= uint64_t(e.capacity > 0) << i;
+        }
+        admissible[0] = adm;
+        forward[0] = fwd;
+        words = count > 0 ? 1 : 0;
+    }
+
+    // Number of set bits of `mask` among arcs 0..i (inclusive)
+    static int count_upto(const std::vector<uint64_t>& mask, int i) {
+        int total = 0;
+        for (int w = 0; w < (i >> 6); ++w) total += __builtin_popcountll(mask[w]);
+        int bit = i & 63;
+        uint64_t low = (bit == 63) ? ~uint64_t(0) : ((uint64_t(1) << (bit + 1)) - 1);
+        return total + __builtin_popcountll(mask[i >> 6] & low);
+    }
+
+    // Number of set bits of `mask` over the whole scanned list
+    int count_all(const std::vector<uint64_t>& mask) const;
+
+private:
+    void scan_long(const EdgeList& edges, int min_residual);  // Kernel path
+
+    template <typename Cap>
+    void scan_generic(const BasicEdgeList<Cap>& edges, long long min_residual) {
+        const int count = edges.size();
+        words = (count + 63) / 64;
+        if (admissible.size() < static_cast<size_t>(words)) {
+            admissible.resize(words);
+            forward.resize(words);
+        }
+        std::fill(admissible.begin(), admissible.begin() + words, 0);
+        std::fill(forward.begin(), forward.begin() + words, 0);
+        for (int i = 0; i < count; ++i) {
+            const auto& e = edges[i];
+            if (e.capacity - e.flow >= min_residual) admissible[i >> 6] |= uint64_t(1) << (i & 63);
+            if (e.capacity > 0) forward[i >> 6] |= uint64_t(1) << (i & 63);
+        }
+    }
+
+    static constexpr int SHORT_LIST = 16;  // Lists up to this length skip the kernel
+    int words = 0;
+};
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+// Bump allocator over one contiguous region reserved up front with mmap and backed by
+// 2 MB transparent huge pages (madvise) where the kernel supports them.
+// Pages are only committed when touched, so a generous capacity costs address space, not RAM.
+// Individual frees are no-ops; release() forgets every allocation in O(1) and the pages
+// stay mapped for the next solve. Anything allocated from the arena must be dead by then.
+class Arena {
+public:
+    static constexpr std::size_t HUGE_PAGE = std::size_t(2) << 20;
+    static constexpr std::size_t DEFAULT_CAPACITY = std::size_t(1) << 30;
+
+    explicit Arena(std::size_t capacity = DEFAULT_CAPACITY);
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    // Returns nullptr when the region is exhausted (or could not be mapped)
+    void* allocate(std::size_t bytes, std::size_t alignment);
+    bool owns(const void* p) const;
+    void release();
+
+    // Uninitialized array of count T's, released with the rest of the arena. When the region
+    // is exhausted (or was never mapped) it comes from heap blocks the arena keeps and reuses
+    // after release(), so a solve that outgrows the region pays for malloc once, not per call.
+    template <typename T>
+    T* allocate_array(std::size_t count) {
+        void* p = allocate(count * sizeof(T), alignof(T));
+        if (!p) p = spill(count * sizeof(T), alignof(T));
+        return static_cast<T*>(p);
+    }
+
+    std::size_t used() const;           // Bytes handed out since the last release()
+    std::size_t capacity() const;
+    bool huge_pages() const;            // True if the kernel accepted MADV_HUGEPAGE
+
+private:
+    void* spill(std::size_t bytes, std::size_t alignment);
+
+    char* mapping = nullptr;            // Start of the mmap'ed block
+    std::size_t mapping_size = 0;
+    char* base = nullptr;               // Huge-page aligned start of the usable region
+    std::size_t size = 0;
+    std::size_t offset = 0;
+    bool advised = false;
+
+    // Heap overflow of allocate_array: bump allocation in the last block, merged into one
+    // block of the total size on release() so the next solve fits without growing again
+    std::vector<std::unique_ptr<char[]>> spill_blocks;
+    std::size_t spill_size = 0;         // Size of the last block
+    std::size_t spill_total = 0;        // Sum of all block sizes
+    std::size_t spill_offset = 0;       // Used bytes of the last block
+};
+
+// Per-thread region for the per-search arrays of the path finders (parent links, queues).
+// Each search releases it before carving its arrays, so augmentations never touch malloc.
+Arena& scratch_arena();
+
+// Standard allocator drawing from an Arena; falls back to the heap when no arena is set
+// or the arena is full, so containers behave exactly as with std::allocator in that case.
+template <typename T>
+struct ArenaAllocator {
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    Arena* arena = nullptr;
+
+    ArenaAllocator() noexcept = default;
+    explicit ArenaAllocator(Arena* arena) noexcept : arena(arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.arena) {}
+
+    T* allocate(std::size_t count) {
+        if (arena) {
+            if (void* p = arena->allocate(count * sizeof(T), alignof(T))) {
+                return static_cast<T*>(p);
+            }
+        }
+        return static_cast<T*>(::operator new(count * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t) noexcept {
+        if (arena && arena->owns(p)) return; // Reclaimed by Arena::release()
+        ::operator delete(p);
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return a.arena == b.arena;
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return a.arena != b.arena;
+}
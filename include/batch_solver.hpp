@@ -0,0 +1,74 @@
+#pragma once
+
+#include "tournament.hpp"
+#include <cstdint>
+#include <vector>
+
+// Decides up to LANES tournaments with the same number of teams in lockstep.
+//
+// Every n-team league gets the same elimination network when all pairs of teams 2..n have
+// a game node (finished pairs just get a zero source capacity), so the structure is
+// stored once in CSR form (offset, to, rev) and only the residual capacities are per
+// instance, interleaved by arc: residual[a * LANES + lane]. Solving is
+//   1. the greedy two-hop warm start of greedy_warm_start, per lane;
+//   2. rounds of one bit-parallel search for all unfinished lanes: each node carries the
+//      mask of lanes that reached it, and an arc passes on the lanes whose residual on it
+//      is positive (one vectorizable compare over the arc's LANES entries), so the
+//      structure is walked once per round instead of once per instance;
+//   3. per lane that reached the sink, one augmenting path through each team node of its
+//      search tree with room left to the sink; a lane stops when its flow saturates the
+//      source ("sim") or the sink becomes unreachable ("não").
+// Leagues where some team already outruns team 1's best total are answered up front.
+class BatchSolver {
+public:
+    static constexpr int LANES = 16;
+
+    explicit BatchSolver(int teams);
+
+    int teams() const;
+
+    // answers[k] = team 1 can still finish strictly first in *batch[k];
+    // every tournament must have teams() teams and count <= LANES
+    void solve(const Tournament* const* batch, int count, bool* answers);
+
+private:
+    using LaneMask = std::uint32_t;
+    static_assert(LANES <= 32 && LANES % 4 == 0, "LaneMask holds one bit per lane, compared 4 at a time");
+
+    LaneMask positive_lanes(int arc) const;
+    void warm_start(int lane);
+    LaneMask search(LaneMask lanes);
+    void augment(int lane);
+
+    int n;                           // Teams
+    int nodes;
+    int source;
+    int sink;
+    int game_start;                  // Game node of pair (i, j), 1 <= i < j < n: game_start + pair index
+    int team_start;                  // Node of team i >= 1: team_start + i - 1
+
+    // Shared structure
+    std::vector<int> offset;
+    std::vector<int> to;
+    std::vector<int> rev;
+    std::vector<int> pair_index;     // pair_index[i * n + j] for 1 <= i < j < n
+    std::vector<int> source_arc;     // Arc source -> game node, by pair index
+    std::vector<int> sink_arc;       // Arc team node -> sink, by team (-1 for team 0)
+    std::vector<int> initial;        // Residual of each arc before an instance is loaded (INF on game -> team)
+
+    // Per lane
+    std::vector<int> residual;       // residual[a * LANES + lane]
+    std::vector<long long> flow;
+    std::vector<long long> target;
+
+    // Search state
+    std::vector<LaneMask> reached;
+    std::vector<LaneMask> pending;   // Lanes that reached a node and have not expanded it yet
+    std::vector<char> queued;
+    std::vector<int> queue;
+    std::vector<int> parent;         // parent[v * LANES + lane] = arc that brought lane to v
+};
+
+// Answers a list of tournaments in batches of consecutive same-size instances
+// (BatchSolver::LANES at a time); answers[k] belongs to tournaments[k]
+void batch_team1_can_win(const std::vector<Tournament>& tournaments, std::vector<char>& answers);
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "presolve.hpp"
+#include <cstdint>
+#include <stdexcept>
+
+// Capacity type a network is built with (see BasicGraph)
+enum class CapacityWidth {
+    COMPACT,  // int16_t arcs (CompactGraph)
+    INT,      // int arcs (Graph)
+    WIDE      // long long arcs (WideGraph)
+};
+
+// Largest single arc capacity and total capacity out of the source
+struct CapacityBounds {
+    long long max_capacity = 0;
+    long long total = 0;
+};
+
+// Narrowest width whose "infinite" arcs (max / 2) still exceed every real capacity
+// and whose flow sums (FlowSum) cannot overflow
+CapacityWidth choose_capacity_width(const CapacityBounds& bounds);
+
+// Bounds of the network Graph::fromReduced builds for this tournament
+CapacityBounds capacity_bounds(const ReducedNetwork& net);
+
+// Returns run(Cap()) for the narrowest of int16_t, int and long long that does not throw
+// std::overflow_error. Meant for DIMACS instances, whose bounds are only known once parallel
+// arcs are merged: read_dimacs rejects an instance too wide for its Cap, and `run` reads it
+// again one width up. `run` must leave nothing behind when it throws.
+template <typename Run>
+auto with_narrowest_width(Run&& run) {
+    try {
+        return run(int16_t());
+    } catch (const std::overflow_error&) {}
+    try {
+        return run(int());
+    } catch (const std::overflow_error&) {}
+    return run(static_cast<long long>(0));
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "tournament.hpp"
+#include <vector>
+
+// Proof that team 1 cannot finish strictly first: a set R of teams 2..n that must win more
+// games among themselves than their combined slack, g(R) > sum_{i in R} m[i], with
+// m[i] = maxW1 - w[i] - 1. Whatever happens, some team of R ends with at least maxW1 wins.
+struct EliminationCertificate {
+    std::vector<int> teams;   // R, 0-based team ids in increasing order
+    long long games = 0;      // g(R): remaining games between teams of R
+    long long slack = 0;      // Sum of m[i] over R
+};
+
+// Decides t and, if team 1 is eliminated, fills `cert` and returns true.
+// The prefilter's set is used when it finds one; otherwise the network of
+// Graph::fromTournament is solved to a max flow and R is the set of teams reachable from
+// the source in the residual graph (the source side of the minimal min cut, so the
+// smallest R any min cut gives). Beyond the solve this is one BFS.
+bool find_elimination_certificate(const Tournament& t, EliminationCertificate& cert);
+
+// Checks g(R) > sum m[i] for `teams` (0-based, distinct, all in 1..n-1) against t, without
+// any flow: O(|R|^2 log F) pair lookups plus team 1's own games. Fixtures must be in (i, j)
+// order, as read_tournament leaves them. Lets a stored certificate be revalidated against
+// new standings; a full solve is only needed once it stops holding. Fills `cert` with the
+// counts when given. Returns false for an invalid team list.
+bool verify_elimination_certificate(const Tournament& t, const std::vector<int>& teams,
+                                    EliminationCertificate* cert = nullptr);
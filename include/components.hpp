@@ -0,0 +1,69 @@
+#pragma once
+
+#include "presolve.hpp"
+#include "reorder.hpp"
+#include "engine_model.hpp"
+#include "arena.hpp"
+#include "thread_pool.hpp"
+#include <memory>
+#include <vector>
+
+// Splits a (presolved) tournament network into independent subproblems: the connected
+// components of the graph whose nodes are teams and whose edges are their remaining games,
+// found with a union-find over the fixtures. Teams without games are left out.
+// Team 1 survives iff every component saturates its own source.
+std::vector<ReducedNetwork> split_components(const ReducedNetwork& net);
+
+// Solves every component (largest first) on `threads` threads (0 = all hardware threads)
+// with `engine` (decision-mode capacity scaling by default), started from the greedy
+// warm start flow when warm_start is set. Stops handing out components as soon as one of
+// them proves team 1 is eliminated. Each network is renumbered with node_order before
+// solving. Returns true if all of them saturate.
+bool all_components_saturate(const std::vector<ReducedNetwork>& parts, int threads = 0,
+                             NodeOrder node_order = NodeOrder::NONE,
+                             DecisionEngine engine = DecisionEngine::CAPACITY_SCALING,
+                             bool warm_start = false);
+
+// What the flow stage did, summed over the components actually solved (the rest are
+// skipped once one of them eliminates team 1). Each solve stops at its decision, so
+// `flow` may fall short of the max flow of an eliminating component.
+struct ComponentStats {
+    int components = 0;         // Networks solved
+    long long flow = 0;         // Flow out of their sources when their solves stopped
+    long long capacity = 0;     // Capacity out of their sources
+    long long iterations = 0;   // Augmenting paths (Ford-Fulkerson engines only)
+    long long nodes = 0;
+    long long arcs = 0;         // Forward arcs
+};
+
+// all_components_saturate with state kept between calls: the worker threads and one arena
+// per worker outlive each solve, so a process answering many tournaments pays for thread
+// startup and page faults once. With DecisionEngine::AUTO each component runs on the
+// engine `model` predicts to be fastest for it.
+class ComponentSolver {
+public:
+    explicit ComponentSolver(int threads = 0, NodeOrder node_order = NodeOrder::NONE,
+                             DecisionEngine engine = DecisionEngine::CAPACITY_SCALING,
+                             EngineModel model = EngineModel(), bool warm_start = false);
+    ~ComponentSolver();
+
+    ComponentSolver(const ComponentSolver&) = delete;
+    ComponentSolver& operator=(const ComponentSolver&) = delete;
+
+    // Fills `stats`, when given, with the work of this call
+    bool all_saturate(const std::vector<ReducedNetwork>& parts, ComponentStats* stats = nullptr);
+
+private:
+    int threads;
+    NodeOrder node_order;
+    DecisionEngine engine;
+    EngineModel model;
+    bool warm_start;
+    std::unique_ptr<ThreadPool> pool;
+    std::vector<std::unique_ptr<Arena>> arenas;
+};
+
+// Whole decision for one tournament: prefilter, presolve, then the components on `solver`.
+// Returns true if team 1 can still finish strictly first. `stats`, when given, gets the
+// flow work done (all zero if the prefilter or the presolve decided alone).
+bool team1_can_win(const Tournament& tournament, ComponentSolver& solver, ComponentStats* stats = nullptr);
@@ -2,5 +2,15 @@
 
 #include "graph.hpp"
 
-// Returns the max flow from source to sink using Dinic's algorithm
-int dinic_max_flow(Graph& graph, int source, int sink);
\ No newline at end of file
+// How Dinic builds each level graph
+enum class LevelBfs {
+    QUEUE,                 // Textbook queue BFS
+    DIRECTION_OPTIMIZING,  // Top-down/bottom-up hybrid_bfs
+    PARALLEL               // Multi-threaded parallel_bfs (see set_bfs_threads)
+};
+
+// Returns the max flow from source to sink using Dinic's algorithm.
+// Instantiated for the int16_t, int and long long graphs; the hybrid and parallel
+// level BFS read int graphs only, other capacity types fall back to QUEUE.
+template <typename Cap>
+FlowSum<Cap> dinic_max_flow(BasicGraph<Cap>& graph, int source, int sink, LevelBfs level_bfs = LevelBfs::QUEUE);
\ No newline at end of file
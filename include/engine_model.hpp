@@ -0,0 +1,68 @@
+#pragma once
+
+#include "graph.hpp"
+#include "ford_fulkerson.hpp"
+#include <array>
+#include <string>
+
+// Max-flow engine behind the sim/não decision of one component network
+enum class DecisionEngine {
+    CAPACITY_SCALING,  // Ford-Fulkerson with capacity scaling paths, decision mode
+    EDMONDS_KARP,      // Ford-Fulkerson with BFS paths, decision mode
+    DINIC,             // Dinic to the max flow, compared with the source capacity
+    AUTO               // Picked per network by an EngineModel
+};
+
+constexpr int DECISION_ENGINES = 3; // Engines an EngineModel chooses from (AUTO excluded)
+
+// "capacity_scaling", "edmonds_karp", "dinic" or "auto"
+DecisionEngine parse_decision_engine(const std::string& name);
+const char* decision_engine_name(DecisionEngine engine);
+
+// What the model sees of a network, all read in one pass after construction
+struct NetworkFeatures {
+    int nodes = 0;
+    int arcs = 0;            // Forward arcs
+    long long capacity = 0;  // Largest finite forward capacity (C)
+    int max_degree = 0;      // Largest adjacency list, reverse arcs included
+    double fan_out = 0.0;    // Arcs leaving the source per node
+};
+
+// Instantiated for the int16_t, int and long long graphs.
+template <typename Cap>
+NetworkFeatures network_features(const BasicGraph<Cap>& graph);
+
+// Linear model of ln(runtime in ms) per engine over the terms of model_terms;
+// choose() takes the engine with the smallest prediction. The coefficients are fitted
+// offline by bin/bench_engines, which writes them in the text format of save():
+//   one line "<engine name> c0 c1 ... c5" per engine, '#' lines are comments.
+class EngineModel {
+public:
+    static constexpr int TERMS = 6;
+    using Coefficients = std::array<double, TERMS>;
+
+    // 1, ln n, ln m, ln(C + 1), ln(max degree), fan-out
+    static Coefficients model_terms(const NetworkFeatures& f);
+
+    EngineModel(); // Built-in coefficients from bin/bench_engines' default calibration
+
+    // Replaces the coefficients of the engines listed in `path`. Returns false, leaving
+    // the model unchanged, if the file is missing or malformed.
+    bool load(const std::string& path);
+    bool save(const std::string& path) const;
+
+    void set(DecisionEngine engine, const Coefficients& coefficients);
+    double predict(DecisionEngine engine, const NetworkFeatures& f) const;
+    DecisionEngine choose(const NetworkFeatures& f) const;
+
+private:
+    std::array<Coefficients, DECISION_ENGINES> coef;
+};
+
+// Runs `engine` (AUTO resolved through `model`) on a graph without flow, from zero flow or,
+// with warm_start, from greedy_warm_start's flow. Returns true if every arc leaving the
+// source is saturated by the max flow. The Ford-Fulkerson engines fill `stats` when given.
+// Instantiated for the int16_t, int and long long graphs.
+template <typename Cap>
+bool run_decision_engine(BasicGraph<Cap>& graph, DecisionEngine engine, const EngineModel& model,
+                         bool warm_start = false, FFStats* stats = nullptr);
@@ -8,11 +8,12 @@
 using Path = std::vector<std::pair<int, int>>;
 
 namespace bfs_state {
-    // Reusable visited array for BFS across calls
-    inline std::vector<uint64_t> visited;
+    // Reusable visited array for BFS across calls (one per thread, so independent
+    // solves can run concurrently)
+    inline thread_local std::vector<uint64_t> visited;
 
     // Token to avoid clearing the visited array every time
-    inline uint64_t visitedToken = 1;
+    inline thread_local uint64_t visitedToken = 1;
 
     // Ensures visited array is large enough and increments the token
     inline void reset(int n) {
@@ -23,4 +24,6 @@ namespace bfs_state {
 
 // Finds an s-t augmenting path using BFS.
 // Returns true if a valid path was found, storing it in `path`.
-bool bfs_path(const Graph& graph, int s, int t, Path& path, FFStats* stats);
\ No newline at end of file
+// Instantiated for the int16_t, int and long long graphs.
+template <typename Cap>
+bool bfs_path(const BasicGraph<Cap>& graph, int s, int t, Path& path, FFStats* stats);
\ No newline at end of file
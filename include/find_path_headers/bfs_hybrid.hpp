@@ -0,0 +1,27 @@
+#pragma once
+
+#include "graph.hpp"
+#include "ford_fulkerson.hpp" // for FFStats
+#include <vector>
+#include <utility>
+
+using Path = std::vector<std::pair<int, int>>;
+
+// Counts of the work done by one hybrid BFS
+struct BfsCounters {
+    int visited_nodes = 0;
+    int visited_arcs_forward = 0;
+    int visited_arcs_residual = 0;
+};
+
+// Level-synchronous BFS over the residual graph with bitmap frontiers.
+// Each level is expanded top-down (frontier -> neighbours) or bottom-up (every unvisited
+// node looks for a parent in the frontier), whichever is cheaper (Beamer et al. heuristic).
+// Fills level[v] (-1 if unreached) and, when `parent` is given, parent[v] = (u, index of u->v in adj[u]).
+// With stop_at_t the search ends with the level that reaches t.
+// Returns true if t was reached.
+bool hybrid_bfs(const Graph& graph, int s, int t, std::vector<int>& level,
+                std::vector<std::pair<int, int>>* parent, bool stop_at_t, BfsCounters* counters = nullptr);
+
+// Edmonds-Karp path finder on top of hybrid_bfs (drop-in for bfs_path).
+bool bfs_hybrid_path(const Graph& graph, int s, int t, Path& path, FFStats* stats);
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "graph.hpp"
+#include "ford_fulkerson.hpp" // for FFStats
+#include "find_path_headers/bfs_hybrid.hpp" // for BfsCounters
+#include <vector>
+#include <utility>
+
+using Path = std::vector<std::pair<int, int>>;
+
+// Number of threads used by the parallel_bfs calls made from the calling thread
+// (0 = all hardware threads, the default). Each calling thread has its own pool and buffers.
+void set_bfs_threads(int threads);
+int get_bfs_threads();
+
+// Level-synchronous BFS over the residual graph expanded by several threads.
+// Frontier arcs are cut into fixed-size chunks (a high-degree node such as the tournament
+// source becomes many chunks) that threads claim dynamically; nodes are claimed with a
+// compare-and-swap on an epoch-token visited array.
+// Same contract as hybrid_bfs: fills level (and parent, if given); returns true if t was reached.
+bool parallel_bfs(const Graph& graph, int s, int t, std::vector<int>& level,
+                  std::vector<std::pair<int, int>>* parent, bool stop_at_t, BfsCounters* counters = nullptr);
+
+// Edmonds-Karp path finder on top of parallel_bfs (drop-in for bfs_path).
+bool bfs_parallel_path(const Graph& graph, int s, int t, Path& path, FFStats* stats);
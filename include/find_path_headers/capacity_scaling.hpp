@@ -11,4 +11,6 @@ using Path = std::vector<std::pair<int, int>>;
 // Finds an s-t augmenting path using capacity scaling DFS.
 // Only explores edges with residual capacity >= current delta threshold.
 // Compatible with Ford-Fulkerson signature.
-bool capacity_scaling_path(const Graph& graph, int s, int t, Path& path, FFStats* stats);
+// Instantiated for the int16_t, int and long long graphs.
+template <typename Cap>
+bool capacity_scaling_path(const BasicGraph<Cap>& graph, int s, int t, Path& path, FFStats* stats);
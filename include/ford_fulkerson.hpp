@@ -1,13 +1,14 @@
 #pragma once
 #include "graph.hpp"
-#include <functional>
 #include <vector>
 
+class TraceWriter;
+
 // Each pair represents an edge used in the path: (from_node, index of edge in graph[from_node])
 using Path = std::vector<std::pair<int, int>>;
 
 // Available path-finding strategies
-enum class AlgorithmType { DFS_RANDOM, BFS_EDMONDS_KARP, FATTEST_PATH, CAPACITY_SCALING };
+enum class AlgorithmType { DFS_RANDOM, BFS_EDMONDS_KARP, FATTEST_PATH, CAPACITY_SCALING, PARALLEL_PUSH_RELABEL };
 
 // Struct to collect algorithm-level statistics
 struct FFStats {
@@ -58,16 +59,44 @@ struct FFStats {
     double avg_update_normalized_m = 0.0;  // average updates normalized by m
     double avg_update_normalized_theoretical = 0.0; // normalized updates by expected value ( (α−1)n ln n for m = n^α )
 
+    // === Push-relabel counters (used only in PARALLEL_PUSH_RELABEL) ===
+    std::vector<long long> pushes_per_thread;   // pushes done by each worker thread
+    std::vector<long long> relabels_per_thread; // relabels done by each worker thread
+    int global_relabels = 0;                    // global relabels between parallel phases
+
 	// === Aux for capacity scaling ===
 	bool max_cap_initialized = false;
-	int delta;
-	int max_cap;
+	long long delta = 0;      // wide enough for every capacity type
+	long long max_cap = 0;
+
+    // === Optional trace ===
+    TraceWriter* trace = nullptr; // If set, every augmentation is streamed to it (see trace_writer.hpp)
+
+	// Back to a fresh FFStats, keeping the vectors' capacity so a reused
+	// FFStats does not reallocate its per-iteration counters (the trace is kept too)
+	void clear();
 };
 
 
-// Type for a path-finding strategy function
-using PathFindingStrategy = std::function<bool(const Graph&, int s, int t, Path& path, FFStats* stats)>;
+// Type for a path-finding strategy function (a plain function pointer, so the
+// templated finders can be passed by name and resolve to the graph's capacity type)
+template <typename Cap>
+using BasicPathFindingStrategy = bool (*)(const BasicGraph<Cap>&, int s, int t, Path& path, FFStats* stats);
+using PathFindingStrategy = BasicPathFindingStrategy<int>;
 
 // Runs Ford-Fulkerson algorithm using a given strategy.
+// Continues from any flow already installed in the graph (e.g. a warm start).
 // Returns the maximum flow value and optionally stores flow path stats.
-int ford_fulkerson(Graph& graph, int s, int t, PathFindingStrategy find_path, AlgorithmType type, FFStats* stats);
+// Instantiated for the int16_t, int and long long graphs.
+template <typename Cap>
+FlowSum<Cap> ford_fulkerson(BasicGraph<Cap>& graph, int s, int t, BasicPathFindingStrategy<Cap> find_path,
+                            AlgorithmType type, FFStats* stats);
+
+// Decision version of ford_fulkerson: does the max flow saturate every arc leaving s?
+// Stops as soon as the flow reaches total_out_capacity(s) ("sim"), or as soon as a cut
+// with capacity below that total is found ("não"): the sink-side cut is checked up front
+// and, for CAPACITY_SCALING, the cut left by each stalled delta-phase is checked too.
+// The graph keeps whatever flow was found when the search stopped.
+template <typename Cap>
+bool ford_fulkerson_saturates(BasicGraph<Cap>& graph, int s, int t, BasicPathFindingStrategy<Cap> find_path,
+                              AlgorithmType type, FFStats* stats);
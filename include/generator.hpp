@@ -0,0 +1,47 @@
+#pragma once
+
+#include "tournament.hpp"
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Generator for stream `stream` of `seed`; streams with the same seed are independent
+std::mt19937_64 seeded_rng(std::uint64_t seed, int stream);
+
+// Uniform integer in [0, range) by multiply-shift of one 64-bit draw (bias below range / 2^64)
+inline int bounded_random(std::mt19937_64& rng, int range) {
+    return static_cast<int>((static_cast<unsigned __int128>(rng()) * static_cast<unsigned>(range)) >> 64);
+}
+
+// Uniform double in [0, 1) from the top 53 bits of one draw
+inline double unit_random(std::mt19937_64& rng) {
+    return (rng() >> 11) * 0x1.0p-53;
+}
+
+// Parameters of one random league, as in bin/gen_tournament
+struct GeneratorParams {
+    int teams = 10;       // n
+    int rounds = 2;       // c: games between every pair of teams
+    double alpha = 0.5;   // Fraction of the c * n(n-1)/2 games already played
+    double bias = 0.1;    // Added to team 1's chance of winning each of its games
+};
+
+// Draws random leagues with the parameters and distribution of bin/gen_tournament, without
+// its rejection loop: each of the ceil(alpha * N) played games goes to a pair drawn
+// uniformly among the pairs that still have games left, which are kept in an array with
+// O(1) swap-remove, so the cost is O(n^2 + alpha * N) whatever alpha is. Each pair (i, j)
+// gets a win probability p = U(0,1) (+ bias if i is team 1, clamped to [0, 1]) drawn only
+// if it played, and each of its played games goes to i with probability p.
+// Buffers are kept between calls; one generator per thread.
+class TournamentGenerator {
+public:
+    // Streams with the same seed but different stream numbers are independent
+    TournamentGenerator(std::uint64_t seed, int stream = 0);
+
+    void generate(const GeneratorParams& params, Tournament& out);
+
+private:
+    std::mt19937_64 rng;
+    std::vector<int> live;     // Pair indices; those with games left are kept at the front
+    std::vector<int> played;   // Games played by each pair (upper triangle, row by row)
+};
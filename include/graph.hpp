@@ -3,15 +3,24 @@
 #include <vector>
 #include <iostream>
 #include <string>
+#include <cstdint>
+#include <type_traits>
+#include "arena.hpp"
 
-// Represents a directed edge with a reverse edge in the residual graph
-struct Edge {
+struct Tournament;
+struct ReducedNetwork;
+
+// Represents a directed edge with a reverse edge in the residual graph.
+// Cap is the capacity/flow type: int16_t for compact tournament networks,
+// int by default, long long for totals that do not fit in an int.
+template <typename Cap>
+struct BasicEdge {
     int id;       // Unique ID (forward >=0, reverse = -1)
     int to;       // Destination node
     int from;     // Source node (for debugging and utilities)
     int rev;      // Index of reverse edge in the destination's adjacency list
-    int capacity; // Max capacity of the edge
-    int flow;     // Current flow through this edge
+    Cap capacity; // Max capacity of the edge
+    Cap flow;     // Current flow through this edge
 
     // True if this edge is a residual edge (no capacity)
     bool is_residual() const {
@@ -19,12 +28,12 @@ struct Edge {
     }
 
     // Residual capacity = capacity - flow
-    int remaining_capacity() const {
+    Cap remaining_capacity() const {
         return capacity - flow;
     }
 
     // Increases flow and decreases the reverse edge flow
-    void augment(int bottleneck, Edge& reverse_edge) {
+    void augment(Cap bottleneck, BasicEdge& reverse_edge) {
         flow += bottleneck;
         reverse_edge.flow -= bottleneck;
     }
@@ -40,14 +49,38 @@ struct Edge {
     }
 };
 
-class Graph {
+// Adjacency storage; drawn from an Arena when the graph was given one, from the heap otherwise
+template <typename Cap>
+using BasicEdgeList = std::vector<BasicEdge<Cap>, ArenaAllocator<BasicEdge<Cap>>>;
+template <typename Cap>
+using BasicAdjacencyList = std::vector<BasicEdgeList<Cap>, ArenaAllocator<BasicEdgeList<Cap>>>;
+
+// Type of flow values and capacity sums: never narrower than int, so a compact
+// network still reports totals above 32767 correctly
+template <typename Cap>
+using FlowSum = std::common_type_t<Cap, int>;
+
+template <typename Cap>
+class BasicGraph {
 public:
-    Graph(int n = 0); // Initialize a graph with n nodes
+    using Capacity = Cap;
+    using EdgeType = BasicEdge<Cap>;
+    using EdgeListType = BasicEdgeList<Cap>;
+    using AdjacencyListType = BasicAdjacencyList<Cap>;
+
+    BasicGraph(int n = 0, Arena* arena = nullptr); // Initialize a graph with n nodes (adjacency lists in arena, if given)
 
-    void add_edge(int from, int to, int capacity);         // Adds forward and reverse edge
-    void read_dimacs(std::istream& in);                    // Load graph in DIMACS format
-    void fromTournament(std::istream& in);
+    void add_edge(int from, int to, Cap capacity);         // Adds forward and reverse edge
+    void set_terminals(int s, int t);                      // Sets source and sink of a graph built edge by edge
+    void read_dimacs(std::istream& in);                    // Load graph in DIMACS format; std::overflow_error
+                                                           // if it does not fit Cap (see choose_capacity_width)
+    void fromTournament(std::istream& in);                 // Reads a tournament and builds its network
+    void fromTournament(const Tournament& t);              // Builds the elimination network of team 1
+    void fromTournamentParametric(const Tournament& t, int k); // Network where team 1 wins exactly k more games
+    void fromReduced(const ReducedNetwork& net);           // Builds the network of a presolved tournament
     void compress_graph();
+    void permute_nodes(const std::vector<int>& new_id);    // Renumbers nodes (u -> new_id[u]) and their arcs
+    void reset_flow();                                     // Zero flow on every arc (capacities kept)
     void print_residual_graph() const;
 
     // Basic accessors
@@ -56,22 +89,40 @@ public:
     int num_edges() const;                                 // Number of forward edges (original)
     int num_edges_residual() const;                        // Number of forward edges (residual)
     int get_min_edge_id() const;
-    int total_out_capacity(int s) const;                   // Sum of capacities out of node s
+    FlowSum<Cap> total_out_capacity(int s) const;          // Sum of capacities out of node s
+    FlowSum<Cap> net_out_flow(int s) const;                // Net flow currently leaving node s
 
-    const std::vector<Edge>& adj(int u) const;             // Read-only access to adjacents
-    std::vector<std::vector<Edge>>& get_adj();             // Writable adjacency list
-    const std::vector<Edge>& get_neighbors(int u) const;   // Alias to adj()
+    const EdgeListType& adj(int u) const;                  // Read-only access to adjacents
+    AdjacencyListType& get_adj();                          // Writable adjacency list
+    const EdgeListType& get_neighbors(int u) const;        // Alias to adj()
 
     int get_source() const;                                // Source node index
     int get_sink() const;                                  // Sink node index
     bool get_cant_be_champion() const;
+    int original_id(int u) const;                          // Id of node u before any permute_nodes()
 
 private:
+    void reset_adjacency();                                // n empty lists, same arena; forgets any permutation
+
     int n;                                                 // Number of nodes
     int source = -1, sink = -1;                            // Source/sink indices (initialized to -1)
     int next_edge_id = 0;
     int next_edge_id_reverse = 0;
     int next_edge_id_aux = 0;
     bool cant_be_champion = false;
-    std::vector<std::vector<Edge>> adj_list;               // Adjacency list
+    Arena* arena = nullptr;                                // Backing region for adj_list (nullptr = heap)
+    AdjacencyListType adj_list;                            // Adjacency list
+    std::vector<int> original_ids;                         // Empty until the graph is permuted
 };
+
+// Instantiated in graph.cpp
+extern template class BasicGraph<int16_t>;
+extern template class BasicGraph<int>;
+extern template class BasicGraph<long long>;
+
+using Edge = BasicEdge<int>;
+using EdgeList = BasicEdgeList<int>;
+using AdjacencyList = BasicAdjacencyList<int>;
+using Graph = BasicGraph<int>;                             // Default network
+using CompactGraph = BasicGraph<int16_t>;                  // 20-byte arcs for small tournaments
+using WideGraph = BasicGraph<long long>;                   // 64-bit capacities for huge totals
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "tournament.hpp"
+
+// Minimum number of its remaining games team 1 must win to still be able to finish
+// strictly ahead of every other team, or -1 if it is eliminated even winning them all.
+//
+// Uses the network of Graph::fromTournamentParametric, whose sink capacities are all
+// monotone in k. k starts at a lower bound and only grows, so the residual graph of one
+// solve is reused by the next (capacities only increase, the flow stays feasible).
+// After an unsaturated solve with deficiency d, k jumps by ceil(d / n), since each unit
+// of k raises any cut by at most n. `solves` (if given) receives the number of max-flow runs.
+int min_required_wins(const Tournament& t, int* solves = nullptr);
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "tournament.hpp"
+#include <vector>
+
+enum class PrefilterResult { ELIMINATED, INCONCLUSIVE };
+
+// Cheap necessary-condition test run before any max-flow solve.
+// Team 1 is eliminated if some set R of teams 2..n must play more games among
+// themselves than their combined slack: g(R) > sum_{i in R} m[i].
+// Checks single teams (m[i] < 0), every pair with games left and every prefix of
+// the teams sorted by slack, in O(n log n + #fixtures).
+// On ELIMINATED, `certificate` (if given) receives the team set R.
+PrefilterResult elimination_prefilter(const Tournament& t, std::vector<int>* certificate = nullptr);
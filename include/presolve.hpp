@@ -0,0 +1,23 @@
+#pragma once
+
+#include "tournament.hpp"
+#include <vector>
+
+// Smaller elimination network for teams 2..n, equivalent to the one built by
+// Graph::fromTournament for the sim/não decision.
+struct ReducedNetwork {
+    std::vector<int> slack;                 // Sink capacity of each node (merged teams add up)
+    std::vector<std::vector<int>> members;  // Original team ids represented by each node
+    std::vector<Fixture> fixtures;          // Games between nodes; i == j for games inside a merged node
+    int credited_games = 0;                 // Games handed to dropped teams
+    bool cant_be_champion = false;          // Some team already has more wins than team 1 can reach
+};
+
+// Iterative presolve of the tournament network:
+//  1. drops every team whose slack covers all of its remaining games against other
+//     contenders (its sink arc can never saturate), crediting those games to it;
+//  2. merges teams with identical roles (same slack and same games against every other
+//     team) into one node with the summed slack;
+//  3. drops merged nodes that became non-limiting.
+// Team 1 survives the original network iff the reduced one saturates its source.
+ReducedNetwork presolve_tournament(const Tournament& t);
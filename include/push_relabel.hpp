@@ -0,0 +1,16 @@
+#pragma once
+
+#include "graph.hpp"
+#include "ford_fulkerson.hpp" // for FFStats
+
+// Shared-memory parallel push-relabel in the style of Hong's lock-free algorithm.
+// Each active node is owned by exactly one thread at a time; pushes update arc flows and
+// excesses with atomic read-modify-writes and relabels only read (possibly stale) neighbour
+// heights, so no locks are taken on the graph. Idle threads steal active nodes from the
+// other threads' queues. A global relabel (reverse BFS from t, then from s) runs between
+// parallel phases, after every n relabels.
+//
+// threads = 0 uses all hardware threads. Continues from any flow already in the graph and
+// leaves the final flow in it. Fills stats->pushes_per_thread / relabels_per_thread.
+// Returns the maximum flow value.
+int parallel_push_relabel(Graph& graph, int s, int t, int threads, FFStats* stats);
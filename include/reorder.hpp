@@ -0,0 +1,24 @@
+#pragma once
+
+#include "graph.hpp"
+#include <string>
+#include <vector>
+
+// Node numberings for better cache locality during searches
+enum class NodeOrder {
+    NONE,                   // Keep the builder's numbering
+    BFS,                    // Breadth-first order from the source
+    REVERSE_CUTHILL_MCKEE,  // Bandwidth-reducing order (neighbours by increasing degree, reversed)
+    TEAM_MAJOR              // Each node feeding the sink right after its predecessors (tournament: games of a team, then the team)
+};
+
+// Parses "none", "bfs", "rcm" or "team"; throws std::invalid_argument otherwise
+NodeOrder parse_node_order(const std::string& name);
+
+// Returns new_id[u] for every node u of the graph
+template <typename Cap>
+std::vector<int> compute_node_order(const BasicGraph<Cap>& graph, NodeOrder order);
+
+// Renumbers the graph in place (see BasicGraph::permute_nodes); does nothing for NONE
+template <typename Cap>
+void reorder_graph(BasicGraph<Cap>& graph, NodeOrder order);
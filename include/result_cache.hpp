@@ -0,0 +1,49 @@
+#pragma once
+
+#include "tournament.hpp"
+#include "components.hpp"
+#include <cstddef>
+#include <filesystem>
+#include <string>
+
+// Key of an instance in the result cache: FNV-1a (128 bits) of its text with whitespace
+// normalized (tokens joined by single spaces, so line breaks and indentation do not matter)
+// followed by the engine name, as 32 hex digits. Costs one pass over the bytes, no parsing.
+std::string instance_key(const char* data, std::size_t size, const std::string& engine);
+
+// What one solve leaves in the cache: the answer and the work of the flow stage behind it
+// (see ComponentStats; all zero when the prefilter or the presolve decided alone)
+struct CachedResult {
+    bool team1_can_win = false;
+    long long max_flow = 0;       // Flow when the component solves stopped
+    long long games_total = 0;    // Capacity out of the sources of the components solved
+    long long iterations = 0;     // Augmenting paths
+    long long nodes = 0;
+    long long arcs = 0;           // Forward arcs
+    double runtime_ms = 0.0;      // Of the solve that produced the entry
+};
+
+// The decision of team1_can_win on `solver` (prefilter, presolve, components), with the
+// stats of the flows it ran
+CachedResult solve_for_cache(const Tournament& t, ComponentSolver& solver);
+
+// On-disk cache of CachedResult by instance_key, one small text file per key under
+// dir/<first two hex digits>/. Safe for any number of concurrent reader and writer
+// processes: an entry is written to a file of its own and renamed into place, so a reader
+// sees either no entry or a complete one, and racing writers of the same key store the
+// same result. Entries are checked against their key when read; anything unreadable
+// counts as a miss.
+class ResultCache {
+public:
+    explicit ResultCache(std::filesystem::path dir);
+
+    bool load(const std::string& key, CachedResult& out) const;
+
+    // Returns false if the entry could not be written (the cache is only an optimization)
+    bool store(const std::string& key, const CachedResult& result) const;
+
+private:
+    std::filesystem::path entry_path(const std::string& key) const;
+
+    std::filesystem::path dir;
+};
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "graph.hpp"
+#include "tournament.hpp"
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// What-if questions on one league ("if team 1 wins its next three games and team 7 loses
+// to team 9, is team 1 still alive?") without rebuilding and re-solving the network.
+//
+// The explorer builds the network of Graph::fromTournament once and solves it to a max
+// flow. A scenario is a sequence of changes on top of it: a played game lowers the
+// capacity of its pair's source arc and the winner's sink arc (every sink arc when team 1
+// loses). Flow left above a lowered capacity is cancelled along flow-carrying arcs back to
+// the source and on to the sink, and team1_alive() augments the repaired flow to a max flow
+// again, so a question costs a few augmenting paths instead of a full solve.
+// Every arc write (capacity or flow) is recorded in an undo log before it happens, so
+// rollback() restores a checkpoint in time proportional to the writes made since it,
+// not to the size of the network.
+class ScenarioExplorer {
+public:
+    explicit ScenarioExplorer(const Tournament& t);
+
+    // One remaining game between teams i and j (0-based, either order), won by `winner`.
+    // Throws std::invalid_argument if a team is out of range, the pair has no game left
+    // or the winner is not one of the two.
+    void play(int i, int j, int winner);
+
+    // Sets the capacity of the forward arc graph().adj(u)[k], repairing the flow if it
+    // no longer fits. Throws std::invalid_argument for reverse arcs and negative capacities.
+    void set_capacity(int u, int k, int capacity);
+
+    // Can team 1 still finish strictly first after the changes so far?
+    // The augmentations it makes are logged like any other change.
+    bool team1_alive();
+
+    void checkpoint();                   // Marks the current scenario
+    void rollback();                     // Back to the last checkpoint (dropping it), or to the base league
+    int depth() const;                   // Checkpoints held
+    std::size_t logged_writes() const;   // Undo log entries since the base solve
+
+    int wins(int team) const;            // Wins of `team` in the current scenario
+    int games_left(int i, int j) const;  // Games left between teams i and j
+    const Graph& graph() const;
+
+private:
+    // Value of an arc before a write
+    struct ArcWrite {
+        int node;
+        int index;
+        int capacity;
+        int flow;
+    };
+    // Value of a tally slot before a write
+    struct TallyWrite {
+        int slot;
+        int value;
+    };
+
+    void set_tally(int slot, int value);
+    void push(int u, int k, int amount);   // Logged flow change on adj[u][k] and its reverse
+    void rebalance(int u, int surplus);    // Cancels inflow - outflow at u along flow-carrying arcs
+    void update_sink(int team);
+    int max_wins_team1() const;
+    int augment();                         // Pushes one shortest augmenting path; returns its flow (0 = none)
+
+    int n;
+    int fixtures;
+    Graph net;
+    int source;
+    int sink;
+    std::vector<int> fixture_of;     // fixture_of[i * n + j] for i < j (-1 = no games at the start)
+    std::vector<int> source_arc;     // Index in adj[source] of each fixture's arc (-1 for team 1's games)
+    std::vector<int> team_node;      // Node of team i >= 1
+    std::vector<int> sink_arc;       // Index in adj[team_node[i]] of its arc into the sink
+    std::vector<int> tally;          // Games left of each fixture, then wins of each team
+
+    std::vector<ArcWrite> arc_log;
+    std::vector<TallyWrite> tally_log;
+    std::vector<std::pair<std::size_t, std::size_t>> marks;   // Log sizes at each checkpoint
+
+    // Scratch for rebalance() and augment()
+    std::vector<long long> imbalance;
+    std::vector<int> pending;
+    std::vector<int> parent_node;
+    std::vector<int> parent_arc;
+    std::vector<int> queue;
+};
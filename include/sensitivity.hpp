@@ -0,0 +1,41 @@
+#pragma once
+
+#include "tournament.hpp"
+#include <vector>
+
+// Where an arc stands among the minimum cuts of a max-flow network (Picard-Queyranne):
+// in every min cut (saturated, tail reachable from s and head reaching t in the residual
+// graph), in some but not all (saturated, ends in different strongly connected components
+// of the residual graph), or in none.
+enum class CutMembership { EVERY, SOME, NONE };
+
+// One game node of Graph::fromTournament: the remaining games between teams i and j >= 1
+struct GameSensitivity {
+    int i;
+    int j;
+    int games;
+    CutMembership cut;       // Of the source -> game arc (the game -> team arcs are infinite: never cut)
+    bool flips_if_i_wins;    // One more game won by i changes the answer
+    bool flips_if_j_wins;
+};
+
+struct SensitivityReport {
+    bool team1_can_win = false;
+    long long max_flow = 0;
+    long long games_total = 0;                // Capacity out of the source
+    std::vector<CutMembership> team_cut;      // Of each team's arc into the sink (NONE for team 0)
+    std::vector<GameSensitivity> games;       // One per game node, in fixture order
+};
+
+// Which remaining games decide team 1's fate, from the residual graph of one max-flow solve
+// instead of one solve per game with its result forced.
+// A game won by i lowers the game's source arc and i's sink arc by one: every team set R
+// holding i but not j loses one unit of slack, no set gains any. So an eliminated team 1
+// stays eliminated whatever happens, and a team 1 that is alive is eliminated iff some min
+// cut holds i on the source side and j on the sink side, i.e. neither j nor t is reachable
+// from i in the residual graph. Cut membership and reachability come from one pass over the
+// strongly connected components of the residual graph (team reachability as bitsets along
+// the condensation, O(m * n / 64)).
+// Team 1's own games are not game nodes; winning them never changes the answer and losing
+// them lowers every slack at once, which this one-unit analysis does not cover.
+SensitivityReport critical_games(const Tournament& t);
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "tournament.hpp"
+#include <cstdint>
+#include <vector>
+
+// Chance that the first team of each remaining game wins it
+struct WinModel {
+    std::vector<double> p;   // p[f]: probability that fixtures[f].i beats fixtures[f].j
+};
+
+// Every game is a coin flip, except team 1 wins its games with probability 0.5 + bias
+WinModel even_win_model(const Tournament& t, double bias);
+
+// The model of bin/gen_tournament: p = U(0,1) per pair, plus bias for team 1's pairs
+// (clamped to [0, 1]), drawn once from `seed`
+WinModel random_win_model(const Tournament& t, double bias, std::uint64_t seed);
+
+struct SimulationResult {
+    long long samples = 0;
+    long long alive = 0;          // Samples in which team 1 can still finish strictly first
+    long long flow_solves = 0;    // Samples that needed a max-flow solve
+    double probability = 0.0;     // alive / samples
+    double ci_low = 0.0;          // Wilson score interval on probability
+    double ci_high = 0.0;
+};
+
+// Wilson score interval for `successes` out of `trials` at normal quantile z (1.96 = 95%)
+void wilson_interval(long long successes, long long trials, double z, double& low, double& high);
+
+// Monte Carlo estimate of team 1 still being able to finish strictly first once a
+// fraction `alpha` of the remaining games has been played.
+// Each sample picks ceil(alpha * R) of the R remaining games (a partial shuffle of the game
+// slots, continued from the previous sample's permutation), draws their winners from the
+// model and decides the resulting league in memory. Every thread keeps one elimination
+// network with the layout of Graph::fromTournament for the whole run: a sample only
+// rewrites the source (games left) and sink (slack) capacities, starts from the greedy warm
+// start and finishes with decision-mode capacity scaling. When consecutive samples differ in
+// few games (2 * played at most 1/8 of the games nodes), the greedy start is laid on top of
+// the previous sample's flow, made feasible again with repair_flow, instead of on zero flow.
+// Samples whose slacks already go negative skip the solve.
+// Samples are split over `threads` threads (0 = all hardware threads), each with its own
+// generator seeded from (seed, thread id). z sets the confidence interval (1.96 = 95%).
+SimulationResult simulate_championship(const Tournament& t, const WinModel& model, double alpha,
+                                       long long samples, int threads, std::uint64_t seed,
+                                       double z = 1.96);
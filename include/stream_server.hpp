@@ -0,0 +1,19 @@
+#pragma once
+
+#include "reorder.hpp"
+#include "engine_model.hpp"
+#include <iostream>
+
+// Persistent worker mode: answers a stream of instances, one line per instance, until EOF.
+//   - a tournament in the dense or sparse format   -> "sim" / "não"
+//   - "dimacs <bytes>" followed by a newline and
+//     exactly <bytes> bytes of a DIMACS max problem -> the max flow value
+// Malformed instances get an "erro: ..." line; a header, DIMACS block or tournament cut
+// short by EOF ends the stream after its error line. Threads, arenas and the path finders'
+// workspace are kept between instances, and the output is flushed after every answer,
+// so requests can be piped in one at a time. Returns the number of lines written.
+// Tournaments are decided on `engine`, from the greedy warm start if asked (see ComponentSolver).
+long long serve_stream(std::istream& in, std::ostream& out, int threads = 0,
+                       NodeOrder node_order = NodeOrder::NONE,
+                       DecisionEngine engine = DecisionEngine::CAPACITY_SCALING,
+                       const EngineModel& model = EngineModel(), bool warm_start = false);
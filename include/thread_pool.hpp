@@ -0,0 +1,38 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads that run the same job in lockstep.
+// run(job) calls job(tid) once on every thread (tid 0 is the calling thread)
+// and returns when all of them are done, so consecutive run() calls act as barriers.
+class ThreadPool {
+public:
+    explicit ThreadPool(int threads);  // Total threads, including the caller
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    int size() const;
+    void run(const std::function<void(int)>& job);
+
+    // Threads to use when the caller asks for 0 (all hardware threads, at least 1)
+    static int default_threads();
+
+private:
+    void worker_loop(int tid);
+
+    int threads;
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable start_cv;
+    std::condition_variable done_cv;
+    const std::function<void(int)>* job = nullptr;
+    unsigned long long generation = 0;  // Incremented on every run()
+    int pending = 0;                    // Workers still running the current job
+    bool stopping = false;
+};
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <vector>
+#include <iostream>
+
+// Remaining games between teams i and j (i < j, games > 0)
+struct Fixture {
+    int i;
+    int j;
+    int games;
+};
+
+// A league state as read from the tournament text format.
+// Team 0 is the team we want to know about ("team 1" in the statement).
+struct Tournament {
+    int n = 0;                       // Number of teams
+    std::vector<int> w;              // Current wins of each team
+    std::vector<Fixture> fixtures;   // Only pairs that still have games to play
+
+    int remaining_games(int team) const;   // Games left for `team` against anyone
+    int max_wins_team1() const;            // w[0] + all of team 0's remaining games
+    std::vector<int> slack() const;        // m[i] = maxW1 - w[i] - 1 (unclamped, m[0] = 0)
+    void sort_fixtures();                  // (i, j) order with repeated pairs merged; O(F) if already sorted
+};
+
+// Reads one instance in any of the formats below, told apart by its first character:
+// 'S' for the sparse text format, 'T' for a binary record, a digit for the dense text
+// format (n, the n wins and the upper triangle of the remaining games matrix).
+// Throws std::runtime_error if there is no complete, valid instance of at least two teams.
+Tournament read_tournament(std::istream& in);
+
+// Same, into an existing Tournament whose vectors are reused.
+// Returns false if the stream ended (or failed) before a complete instance.
+bool read_tournament(std::istream& in, Tournament& t);
+
+// Writes t in the text format above (the full upper triangle, zeros included).
+// Fixtures must be in (i, j) order, as read_tournament leaves them.
+void write_tournament(std::ostream& out, const Tournament& t);
+
+// Sparse text format, for leagues where most pairs have nothing left to play:
+//   S n
+//   the n wins
+//   F
+//   F lines "i j games" (teams 1..n), only for pairs with games left
+// Size and load time grow with n + F instead of n^2.
+void write_tournament_sparse(std::ostream& out, const Tournament& t);
+
+// Reads one sparse instance (vectors reused). Pairs may come in any order and either way
+// round; they are left in (i, j) order with repeated pairs merged.
+// Returns false at the end of the stream or on a malformed instance.
+bool read_tournament_sparse(std::istream& in, Tournament& t);
+
+// Binary instance record, all fields int32 in host byte order:
+//   "TFB1", n, the n wins, the number of fixtures, then i, j, games for each fixture.
+// Records can be concatenated; a file of them is read one instance per call.
+void write_tournament_binary(std::ostream& out, const Tournament& t);
+
+// Reads one binary record into t (vectors reused). Pairs are left in (i, j) order with
+// repeated pairs merged; a fixture with games <= 0 makes the record invalid.
+// Returns false at the end of the stream or on a truncated or invalid record.
+bool read_tournament_binary(std::istream& in, Tournament& t);
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "arena.hpp"
+#include "components.hpp"
+#include "ford_fulkerson.hpp"
+#include "graph.hpp"
+#include "tournament.hpp"
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+// Public interface of libtournamentflow (bin/libtournamentflow.a and bin/libtournamentflow.so).
+//
+// A FlowSolver is a reusable handle for embedding the solver in another process:
+// load an instance from memory, solve it with any engine (as many times as wanted),
+// read the stats, load the next one. The handle owns every buffer involved: the network
+// lives in its arena (released on each load), the parsed arcs and the tournament reuse
+// their vectors, and the engines' per-search arrays come from the per-thread scratch
+// arena, so once the buffers have grown to the largest instance seen, loading and solving
+// with the Edmonds-Karp, capacity scaling and Dinic engines do not touch the heap.
+// Push-relabel still builds its own flat copy of the network on every solve.
+//
+// Loads throw std::invalid_argument on malformed input. A handle is not thread-safe;
+// use one per thread.
+
+// Max-flow engine used by FlowSolver::solve
+enum class FlowEngine {
+    EDMONDS_KARP,           // Ford-Fulkerson with BFS paths
+    CAPACITY_SCALING,       // Ford-Fulkerson with capacity scaling paths
+    DINIC,                  // Dinic with queue-built level graphs
+    PUSH_RELABEL,           // Parallel push-relabel (int networks only)
+    EDMONDS_KARP_HYBRID,    // Ford-Fulkerson with direction-optimizing BFS paths (int networks only)
+    DINIC_HYBRID,           // Dinic with direction-optimizing level BFS (int networks only)
+    EDMONDS_KARP_PARALLEL,  // Ford-Fulkerson with multi-threaded BFS paths (int networks only)
+    DINIC_PARALLEL          // Dinic with multi-threaded level BFS (int networks only)
+};
+
+// What the last solve did
+struct FlowSolveStats {
+    long long max_flow = 0;
+    int iterations = 0;          // Augmenting paths (pushes for PUSH_RELABEL, 0 for DINIC)
+    int nodes = 0;
+    int arcs = 0;                // Forward arcs of the network
+    double runtime_ms = 0.0;
+};
+
+class FlowSolver {
+public:
+    explicit FlowSolver(int threads = 0);   // 0 = all hardware threads (push-relabel, parallel BFS, components)
+
+    FlowSolver(const FlowSolver&) = delete;
+    FlowSolver& operator=(const FlowSolver&) = delete;
+
+    // A tournament in the dense or the sparse text format of the tournament binary
+    // (see read_tournament); the network solved is team 1's elimination network
+    // (Graph::fromTournament)
+    void load_tournament(const char* data, std::size_t size);
+
+    // A DIMACS max-flow problem. Parallel arcs are kept as separate arcs; networks whose
+    // capacities or flow do not fit in an int are built with 64-bit capacities.
+    void load_dimacs(const char* data, std::size_t size);
+
+    // Max flow of the loaded network from zero flow; throws std::logic_error when nothing
+    // is loaded, or for an int-only engine on a 64-bit network
+    long long solve(FlowEngine engine);
+
+    // Full decision for the loaded tournament (prefilter, presolve, components):
+    // can team 1 still finish strictly first? Throws std::logic_error after load_dimacs.
+    bool team1_can_win();
+
+    const FlowSolveStats& stats() const;
+
+private:
+    // One "a u v cap" line of a DIMACS instance (0-based ends)
+    struct Arc {
+        int from;
+        int to;
+        long long capacity;
+    };
+
+    template <typename Cap>
+    void build_dimacs(std::optional<BasicGraph<Cap>>& graph, int n, int source, int sink);
+    template <typename Cap>
+    long long solve_on(BasicGraph<Cap>& graph, FlowEngine engine);
+
+    int threads;
+    ComponentSolver components;
+    Arena arena;                             // Network storage, released on every load
+    std::optional<Graph> graph;              // The loaded network (int capacities)
+    std::optional<WideGraph> wide_graph;     // ... or the loaded network (long long capacities)
+    bool has_tournament = false;
+    Tournament tournament;
+    std::vector<Arc> arcs;
+    std::vector<int> degree;
+    FFStats ff_stats;
+    FlowSolveStats last;
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// One augmentation of Ford-Fulkerson, as it goes into the trace
+struct TraceAugmentation {
+    const char* strategy = "";   // AlgorithmType name, e.g. "capacity_scaling"
+    int iteration = 0;           // 1-based augmenting path number within the run
+    double start_us = 0.0;       // When the path search began (TraceWriter::now_us)
+    double end_us = 0.0;         // When the augmentation was applied
+    long long delta = 0;         // Capacity scaling phase, 0 for the other strategies
+    int path_length = 0;         // Arcs in the path
+    long long bottleneck = 0;    // Flow added
+    int visited_nodes = 0;       // By the search that found the path
+    int visited_arcs = 0;        // Residual arcs inspected by that search
+};
+
+// Streams Chrome trace-event JSON (chrome://tracing, Perfetto) to a file: a
+// {"traceEvents": [...]} object of complete ("X") events, one per augmentation plus one
+// per run. Events are formatted by the solving thread into a shared buffer and handed to
+// a background thread that does the file writes, so a run only pays for the formatting,
+// never for the disk, and nothing is kept per iteration. If the disk falls behind,
+// producers wait once a few MB are buffered, so memory stays bounded. Safe to share
+// between threads; each solving thread gets a tid of its own in the viewer. The JSON is
+// closed by the destructor, which waits for everything to be written.
+class TraceWriter {
+public:
+    explicit TraceWriter(const std::string& path);
+    ~TraceWriter();
+
+    TraceWriter(const TraceWriter&) = delete;
+    TraceWriter& operator=(const TraceWriter&) = delete;
+
+    bool is_open() const;
+
+    // Microseconds since the writer was created: the trace's time axis
+    double now_us() const;
+
+    void augmentation(const TraceAugmentation& event);
+
+    // A span enclosing the augmentations of one run
+    void run(const char* strategy, double start_us, double end_us, int iterations, long long flow);
+
+private:
+    void append(const char* event, int length);
+    void writer_loop();
+
+    std::FILE* file = nullptr;
+    std::chrono::steady_clock::time_point epoch;
+    std::mutex mutex;
+    std::condition_variable ready_cv;   // Writer: enough to write, or stopping
+    std::condition_variable drained_cv; // Producers: the buffer was taken
+    std::string pending;         // Formatted events not yet taken by the writer thread
+    bool first_event = true;
+    bool stopping = false;
+    std::thread writer;
+};
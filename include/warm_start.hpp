@@ -0,0 +1,22 @@
+#pragma once
+
+#include "graph.hpp"
+
+// Installs a feasible greedy flow along the two-hop paths s -> x -> y -> t
+// (in a tournament network: source -> game -> team -> sink).
+// Each source arc routes its capacity to the neighbour whose arc into the sink
+// has the most remaining slack, spilling the rest to the next best one.
+// The graph is left with a valid flow, so any engine can continue from it.
+// Returns the amount of flow installed. Instantiated for the int16_t, int and long long graphs.
+template <typename Cap>
+FlowSum<Cap> greedy_warm_start(BasicGraph<Cap>& graph, int s, int t);
+
+// Makes the flow in the graph feasible again after some capacities were lowered below
+// the flow their arcs carry (a network reused for a slightly different instance).
+// Each overflowing arc is clipped, and the surplus left at its tail is cancelled along
+// flow-carrying arcs back towards s, the shortage at its head along flow-carrying arcs
+// towards t. Flow on every other path stays installed, so an engine continuing from the
+// result only has to find the difference. Returns the flow value after the repair.
+// Instantiated for the int16_t, int and long long graphs.
+template <typename Cap>
+FlowSum<Cap> repair_flow(BasicGraph<Cap>& graph, int s, int t);
@@ -0,0 +1,88 @@
+#include "arc_scan.hpp"
+#include <algorithm>
+#include <cstddef>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define ARC_SCAN_X86 1
+#endif
+
+static void scan_arcs_scalar(const Edge* edges, int count, int min_residual, uint64_t* admissible, uint64_t* forward) {
+    std::fill(admissible, admissible + (count + 63) / 64, 0);
+    std::fill(forward, forward + (count + 63) / 64, 0);
+
+    for (int i = 0; i < count; ++i) {
+        const Edge& e = edges[i];
+        if (e.capacity - e.flow >= min_residual) admissible[i >> 6] |= uint64_t(1) << (i & 63);
+        if (e.capacity > 0) forward[i >> 6] |= uint64_t(1) << (i & 63);
+    }
+}
+
+#ifdef ARC_SCAN_X86
+// Gathers capacity/flow of 8 arcs at a time straight from the Edge array (no copy into a
+// separate residual array), so the kernel works on the existing adjacency lists.
+__attribute__((target("avx2")))
+static void scan_arcs_avx2(const Edge* edges, int count, int min_residual, uint64_t* admissible, uint64_t* forward) {
+    std::fill(admissible, admissible + (count + 63) / 64, 0);
+    std::fill(forward, forward + (count + 63) / 64, 0);
+
+    const int stride = static_cast<int>(sizeof(Edge));
+    const __m256i offsets = _mm256_setr_epi32(0, stride, 2 * stride, 3 * stride,
+                                              4 * stride, 5 * stride, 6 * stride, 7 * stride);
+    const __m256i threshold = _mm256_set1_epi32(min_residual - 1);
+    const __m256i zero = _mm256_setzero_si256();
+
+    const char* base = reinterpret_cast<const char*>(edges);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const char* chunk = base + static_cast<size_t>(i) * stride;
+        __m256i cap  = _mm256_i32gather_epi32(reinterpret_cast<const int*>(chunk + offsetof(Edge, capacity)), offsets, 1);
+        __m256i flow = _mm256_i32gather_epi32(reinterpret_cast<const int*>(chunk + offsetof(Edge, flow)), offsets, 1);
+        __m256i residual = _mm256_sub_epi32(cap, flow);
+
+        uint32_t adm = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(residual, threshold)));
+        uint32_t fwd = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(cap, zero)));
+
+        // i is a multiple of 8, so the 8 bits never straddle two words
+        admissible[i >> 6] |= uint64_t(adm) << (i & 63);
+        forward[i >> 6] |= uint64_t(fwd) << (i & 63);
+    }
+
+    for (; i < count; ++i) {
+        const Edge& e = edges[i];
+        if (e.capacity - e.flow >= min_residual) admissible[i >> 6] |= uint64_t(1) << (i & 63);
+        if (e.capacity > 0) forward[i >> 6] |= uint64_t(1) << (i & 63);
+    }
+}
+#endif
+
+using ScanKernel = void (*)(const Edge*, int, int, uint64_t*, uint64_t*);
+
+static ScanKernel select_kernel() {
+#ifdef ARC_SCAN_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return scan_arcs_avx2;
+#endif
+    return scan_arcs_scalar;
+}
+
+void scan_arcs(const Edge* edges, int count, int min_residual, uint64_t* admissible, uint64_t* forward) {
+    static const ScanKernel kernel = select_kernel();
+    kernel(edges, count, min_residual, admissible, forward);
+}
+
+void ArcMasks::scan_long(const EdgeList& edges, int min_residual) {
+    int count = edges.size();
+    words = (count + 63) / 64;
+    if (admissible.size() < static_cast<size_t>(words)) {
+        admissible.resize(words);
+        forward.resize(words);
+    }
+    scan_arcs(edges.data(), count, min_residual, admissible.data(), forward.data());
+}
+
+int ArcMasks::count_all(const std::vector<uint64_t>& mask) const {
+    int total = 0;
+    for (int w = 0; w < words; ++w) total += __builtin_popcountll(mask[w]);
+    return total;
+}
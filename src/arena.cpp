@@ -0,0 +1,87 @@
+#include "arena.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <sys/mman.h>
+
+Arena::Arena(std::size_t capacity) {
+    // Round up to whole huge pages and map one extra so the region can start on a 2 MB boundary
+    size = (capacity + HUGE_PAGE - 1) / HUGE_PAGE * HUGE_PAGE;
+    mapping_size = size + HUGE_PAGE;
+
+    void* p = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (p == MAP_FAILED) {
+        mapping_size = size = 0; // allocate() fails, allocate_array() and ArenaAllocator use the heap
+        return;
+    }
+
+    mapping = static_cast<char*>(p);
+    std::uintptr_t aligned = (reinterpret_cast<std::uintptr_t>(mapping) + HUGE_PAGE - 1) & ~(HUGE_PAGE - 1);
+    base = reinterpret_cast<char*>(aligned);
+
+#ifdef MADV_HUGEPAGE
+    advised = madvise(base, size, MADV_HUGEPAGE) == 0;
+#endif
+}
+
+Arena::~Arena() {
+    if (mapping) munmap(mapping, mapping_size);
+}
+
+void* Arena::allocate(std::size_t bytes, std::size_t alignment) {
+    std::size_t start = (offset + alignment - 1) & ~(alignment - 1);
+    if (!base || start + bytes > size) return nullptr;
+    offset = start + bytes;
+    return base + start;
+}
+
+bool Arena::owns(const void* p) const {
+    const char* c = static_cast<const char*>(p);
+    return base && c >= base && c < base + size;
+}
+
+void* Arena::spill(std::size_t bytes, std::size_t alignment) {
+    if (!spill_blocks.empty()) {
+        std::uintptr_t block = reinterpret_cast<std::uintptr_t>(spill_blocks.back().get());
+        std::uintptr_t start = (block + spill_offset + alignment - 1) & ~(alignment - 1);
+        if (start + bytes <= block + spill_size) {
+            spill_offset = start + bytes - block;
+            return reinterpret_cast<void*>(start);
+        }
+    }
+
+    // New block, at least double the last one; new[] is aligned for any fundamental type
+    spill_size = std::max(bytes + alignment, 2 * spill_size);
+    spill_blocks.emplace_back(new char[spill_size]);
+    spill_total += spill_size;
+    spill_offset = 0;
+    return spill(bytes, alignment);
+}
+
+void Arena::release() {
+    offset = 0;
+    spill_offset = 0;
+    if (spill_blocks.size() > 1) {
+        spill_blocks.clear();
+        spill_blocks.emplace_back(new char[spill_total]);
+        spill_size = spill_total;
+    }
+}
+
+std::size_t Arena::used() const {
+    return offset;
+}
+
+std::size_t Arena::capacity() const {
+    return size;
+}
+
+bool Arena::huge_pages() const {
+    return advised;
+}
+
+Arena& scratch_arena() {
+    static constexpr std::size_t SCRATCH_CAPACITY = std::size_t(256) << 20;
+    thread_local Arena arena(SCRATCH_CAPACITY);
+    return arena;
+}
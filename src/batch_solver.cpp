@@ -0,0 +1,292 @@
+#include "batch_solver.hpp"
+#include <algorithm>
+#include <climits>
+#include <memory>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace {
+    constexpr int INF = INT_MAX / 2;
+}
+
+BatchSolver::BatchSolver(int teams) : n(teams) {
+    const int pairs = (n - 1) * (n - 2) / 2;
+    source = 0;
+    game_start = 1;
+    team_start = game_start + pairs;
+    sink = team_start + (n - 1);
+    nodes = sink + 1;
+
+    // Forward arcs in the order of Graph::fromTournament: source -> games, games -> teams, teams -> sink
+    struct Arc {
+        int from, to;
+    };
+    std::vector<Arc> arcs;
+    pair_index.assign(n * n, -1);
+    int p = 0;
+    for (int i = 1; i < n; ++i)
+        for (int j = i + 1; j < n; ++j)
+            pair_index[i * n + j] = p++;
+
+    for (int g = 0; g < pairs; ++g) arcs.push_back({source, game_start + g});
+    for (int i = 1; i < n; ++i) {
+        for (int j = i + 1; j < n; ++j) {
+            int game = game_start + pair_index[i * n + j];
+            arcs.push_back({game, team_start + i - 1});
+            arcs.push_back({game, team_start + j - 1});
+        }
+    }
+    for (int i = 1; i < n; ++i) arcs.push_back({team_start + i - 1, sink});
+
+    // CSR with every forward arc followed by its reverse at the other end
+    offset.assign(nodes + 1, 0);
+    for (const Arc& a : arcs) {
+        ++offset[a.from + 1];
+        ++offset[a.to + 1];
+    }
+    for (int u = 0; u < nodes; ++u) offset[u + 1] += offset[u];
+
+    const int total_arcs = offset[nodes];
+    to.resize(total_arcs);
+    rev.resize(total_arcs);
+    std::vector<int> next(offset.begin(), offset.end() - 1);
+    std::vector<int> forward(arcs.size());
+    for (size_t k = 0; k < arcs.size(); ++k) {
+        int a = next[arcs[k].from]++;
+        int b = next[arcs[k].to]++;
+        to[a] = arcs[k].to;
+        to[b] = arcs[k].from;
+        rev[a] = b;
+        rev[b] = a;
+        forward[k] = a;
+    }
+
+    source_arc.assign(forward.begin(), forward.begin() + pairs);
+    sink_arc.assign(n, -1);
+    for (int i = 1; i < n; ++i) sink_arc[i] = forward[3 * pairs + i - 1];
+
+    // Infinite game -> team arcs; sources and sinks are set per instance
+    initial.assign(total_arcs, 0);
+    for (int k = pairs; k < 3 * pairs; ++k) initial[forward[k]] = INF;
+    residual.assign(static_cast<size_t>(total_arcs) * LANES, 0);
+
+    flow.assign(LANES, 0);
+    target.assign(LANES, 0);
+    reached.assign(nodes, 0);
+    pending.assign(nodes, 0);
+    queued.assign(nodes, 0);
+    parent.assign(static_cast<size_t>(nodes) * LANES, -1);
+}
+
+int BatchSolver::teams() const {
+    return n;
+}
+
+BatchSolver::LaneMask BatchSolver::positive_lanes(int arc) const {
+    const int* r = &residual[static_cast<size_t>(arc) * LANES];
+    LaneMask mask = 0;
+#ifdef __SSE2__
+    // Four lanes per compare; movemask packs their sign bits
+    const __m128i zero = _mm_setzero_si128();
+    for (int lane = 0; lane < LANES; lane += 4) {
+        __m128i positive = _mm_cmpgt_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(r + lane)), zero);
+        mask |= static_cast<LaneMask>(_mm_movemask_ps(_mm_castsi128_ps(positive))) << lane;
+    }
+#else
+    for (int lane = 0; lane < LANES; ++lane) {
+        mask |= static_cast<LaneMask>(r[lane] > 0) << lane;
+    }
+#endif
+    return mask;
+}
+
+// greedy_warm_start on one lane: each game sends its games to the team with the most slack left
+void BatchSolver::warm_start(int lane) {
+    auto res = [&](int a) -> int& { return residual[static_cast<size_t>(a) * LANES + lane]; };
+    auto push = [&](int a, int amount) {
+        res(a) -= amount;
+        res(rev[a]) += amount;
+    };
+
+    for (int sx : source_arc) {
+        const int game = to[sx];
+        while (res(sx) > 0) {
+            int best = -1;
+            int best_slack = 0;
+            for (int a = offset[game]; a < offset[game + 1]; ++a) {
+                if (to[a] == source) continue;
+                int slack = res(sink_arc[to[a] - team_start + 1]);
+                if (slack > best_slack) {
+                    best_slack = slack;
+                    best = a;
+                }
+            }
+            if (best == -1) break; // Both teams are full
+
+            int yt = sink_arc[to[best] - team_start + 1];
+            int amount = std::min(res(sx), best_slack);
+            push(sx, amount);
+            push(best, amount);
+            push(yt, amount);
+            flow[lane] += amount;
+        }
+    }
+}
+
+// One search for all `lanes`; returns the lanes that reached the sink (parent links set)
+BatchSolver::LaneMask BatchSolver::search(LaneMask lanes) {
+    std::fill(reached.begin(), reached.end(), 0);
+    queue.clear();
+
+    reached[source] = lanes;
+    pending[source] = lanes;
+    queued[source] = 1;
+    queue.push_back(source);
+
+    for (size_t head = 0; head < queue.size() && reached[sink] != lanes; ++head) {
+        const int u = queue[head];
+        queued[u] = 0;
+        const LaneMask expand = pending[u];
+        pending[u] = 0;
+
+        for (int a = offset[u]; a < offset[u + 1]; ++a) {
+            const int v = to[a];
+            LaneMask fresh = expand & ~reached[v];
+            if (!fresh) continue;
+            fresh &= positive_lanes(a);
+            if (!fresh) continue;
+
+            reached[v] |= fresh;
+            for (LaneMask bits = fresh; bits; bits &= bits - 1) {
+                parent[static_cast<size_t>(v) * LANES + __builtin_ctz(bits)] = a;
+            }
+            if (v == sink) continue;
+
+            pending[v] |= fresh;
+            if (!queued[v]) {
+                queued[v] = 1;
+                queue.push_back(v);
+            }
+        }
+    }
+
+    // Leave the search state clean for the next round
+    for (size_t head = 0; head < queue.size(); ++head) {
+        pending[queue[head]] = 0;
+        queued[queue[head]] = 0;
+    }
+
+    return reached[sink] & lanes;
+}
+
+// Augments along the lane's search tree: one path through every team node the lane reached
+// that still has room towards the sink, so a search round yields many augmentations
+void BatchSolver::augment(int lane) {
+    auto res = [&](int a) -> int& { return residual[static_cast<size_t>(a) * LANES + lane]; };
+    const LaneMask bit = LaneMask(1) << lane;
+
+    for (int i = 1; i < n && flow[lane] < target[lane]; ++i) {
+        const int team = team_start + i - 1;
+        const int into_sink = sink_arc[i];
+        if (!(reached[team] & bit) || res(into_sink) <= 0) continue;
+
+        // Earlier paths of this round may have used up part of the tree
+        int bottleneck = res(into_sink);
+        for (int v = team; v != source && bottleneck > 0;) {
+            int a = parent[static_cast<size_t>(v) * LANES + lane];
+            bottleneck = std::min(bottleneck, res(a));
+            v = to[rev[a]];
+        }
+        if (bottleneck == 0) continue;
+
+        res(into_sink) -= bottleneck;
+        res(rev[into_sink]) += bottleneck;
+        for (int v = team; v != source;) {
+            int a = parent[static_cast<size_t>(v) * LANES + lane];
+            res(a) -= bottleneck;
+            res(rev[a]) += bottleneck;
+            v = to[rev[a]];
+        }
+        flow[lane] += bottleneck;
+    }
+}
+
+void BatchSolver::solve(const Tournament* const* batch, int count, bool* answers) {
+    LaneMask active = 0;
+
+    // Every lane back to the empty network (unused lanes stay empty and never search)
+    for (int a = 0; a < offset[nodes]; ++a) {
+        std::fill_n(&residual[static_cast<size_t>(a) * LANES], LANES, initial[a]);
+    }
+
+    for (int lane = 0; lane < count; ++lane) {
+        const Tournament& t = *batch[lane];
+        answers[lane] = false;
+        flow[lane] = 0;
+        target[lane] = 0;
+
+        int max_wins = t.w[0];
+        for (const Fixture& f : t.fixtures) {
+            if (f.i == 0) {
+                max_wins += f.games;
+            } else {
+                residual[static_cast<size_t>(source_arc[pair_index[f.i * n + f.j]]) * LANES + lane] = f.games;
+                target[lane] += f.games;
+            }
+        }
+
+        bool eliminated = false;
+        for (int i = 1; i < n; ++i) {
+            int slack = max_wins - t.w[i] - 1;
+            if (slack < 0) eliminated = true;
+            residual[static_cast<size_t>(sink_arc[i]) * LANES + lane] = std::max(slack, 0);
+        }
+        if (eliminated) continue;
+
+        warm_start(lane);
+        if (flow[lane] == target[lane]) {
+            answers[lane] = true;
+        } else {
+            active |= LaneMask(1) << lane;
+        }
+    }
+
+    while (active) {
+        LaneMask found = search(active);
+        active = found; // Lanes that missed the sink are at their max flow, below target
+        for (LaneMask bits = found; bits; bits &= bits - 1) {
+            int lane = __builtin_ctz(bits);
+            augment(lane);
+            if (flow[lane] == target[lane]) {
+                answers[lane] = true;
+                active &= ~(LaneMask(1) << lane);
+            }
+        }
+    }
+}
+
+void batch_team1_can_win(const std::vector<Tournament>& tournaments, std::vector<char>& answers) {
+    answers.assign(tournaments.size(), 0);
+    std::unique_ptr<BatchSolver> solver;
+    const Tournament* batch[BatchSolver::LANES];
+    bool lane_answers[BatchSolver::LANES];
+
+    size_t k = 0;
+    while (k < tournaments.size()) {
+        const int teams = tournaments[k].n;
+        if (teams < 2) {
+            ++k; // Not a league; left as "false"
+            continue;
+        }
+        if (!solver || solver->teams() != teams) solver = std::make_unique<BatchSolver>(teams);
+
+        int count = 0;
+        size_t first = k;
+        while (k < tournaments.size() && tournaments[k].n == teams && count < BatchSolver::LANES) {
+            batch[count++] = &tournaments[k++];
+        }
+        solver->solve(batch, count, lane_answers);
+        for (int lane = 0; lane < count; ++lane) answers[first + lane] = lane_answers[lane];
+    }
+}
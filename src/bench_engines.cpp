@@ -0,0 +1,208 @@
+#include "engine_model.hpp"
+#include "generator.hpp"
+#include "tournament.hpp"
+#include "prefilter.hpp"
+#include "presolve.hpp"
+#include "components.hpp"
+#include "capacity_width.hpp"
+#include "graph.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    const DecisionEngine ENGINES[DECISION_ENGINES] = {
+        DecisionEngine::CAPACITY_SCALING, DecisionEngine::EDMONDS_KARP, DecisionEngine::DINIC
+    };
+
+    // One component network and the best of a few timed runs of every engine on it
+    struct Sample {
+        NetworkFeatures features;
+        double ms[DECISION_ENGINES];
+        bool saturates[DECISION_ENGINES];
+    };
+
+    // Builds a fresh network for every run (not timed) and keeps the fastest run
+    template <typename Cap>
+    void time_engines(const ReducedNetwork& part, Sample& sample) {
+        {
+            BasicGraph<Cap> graph;
+            graph.fromReduced(part);
+            sample.features = network_features(graph);
+        }
+        const EngineModel unused;
+        for (int e = 0; e < DECISION_ENGINES; ++e) {
+            double best = 1e300, total = 0.0;
+            for (int rep = 0; rep < 25 && total < 5.0; ++rep) {
+                BasicGraph<Cap> graph;
+                graph.fromReduced(part);
+                auto start = std::chrono::high_resolution_clock::now();
+                sample.saturates[e] = run_decision_engine(graph, ENGINES[e], unused);
+                std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+                best = std::min(best, elapsed.count());
+                total += elapsed.count();
+            }
+            sample.ms[e] = best;
+        }
+    }
+
+    void time_engines(const ReducedNetwork& part, Sample& sample) {
+        switch (choose_capacity_width(capacity_bounds(part))) {
+            case CapacityWidth::COMPACT: time_engines<int16_t>(part, sample); break;
+            case CapacityWidth::INT:     time_engines<int>(part, sample); break;
+            default:                     time_engines<long long>(part, sample); break;
+        }
+    }
+
+    // Least squares of ln(ms) on the model terms (normal equations). n, m and the max degree
+    // grow together and C is often the same for every network, so the slopes get a small
+    // ridge that keeps them finite without moving the predictions.
+    EngineModel::Coefficients fit(const std::vector<Sample>& samples, int e) {
+        constexpr int K = EngineModel::TERMS;
+        double a[K][K + 1] = {};
+        for (const Sample& s : samples) {
+            const EngineModel::Coefficients x = EngineModel::model_terms(s.features);
+            const double y = std::log(std::max(s.ms[e], 1e-5));
+            for (int r = 0; r < K; ++r) {
+                for (int c = 0; c < K; ++c) a[r][c] += x[r] * x[c];
+                a[r][K] += x[r] * y;
+            }
+        }
+        for (int r = 1; r < K; ++r) a[r][r] += 1e-3 * samples.size();
+
+        // Gaussian elimination with partial pivoting
+        for (int col = 0; col < K; ++col) {
+            int pivot = col;
+            for (int r = col + 1; r < K; ++r) {
+                if (std::fabs(a[r][col]) > std::fabs(a[pivot][col])) pivot = r;
+            }
+            for (int c = 0; c <= K; ++c) std::swap(a[col][c], a[pivot][c]);
+            for (int r = 0; r < K; ++r) {
+                if (r == col || a[col][col] == 0.0) continue;
+                const double factor = a[r][col] / a[col][col];
+                for (int c = col; c <= K; ++c) a[r][c] -= factor * a[col][c];
+            }
+        }
+        EngineModel::Coefficients coef{};
+        for (int r = 0; r < K; ++r) coef[r] = a[r][r] != 0.0 ? a[r][K] / a[r][r] : 0.0;
+        return coef;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int instances = 10;
+    int max_teams = 80;
+    std::uint64_t seed = 2024;
+    std::string out_path = "engine_model.txt";
+    std::string csv_path; // Vazio = sem CSV das medições
+
+    for (int a = 1; a < argc; ++a) {
+        std::string arg = argv[a];
+        if (arg == "--instances" && a + 1 < argc) {
+            instances = std::stoi(argv[++a]);
+        } else if (arg == "--max-teams" && a + 1 < argc) {
+            max_teams = std::stoi(argv[++a]);
+        } else if (arg == "--seed" && a + 1 < argc) {
+            seed = std::stoull(argv[++a]);
+        } else if (arg == "--out" && a + 1 < argc) {
+            out_path = argv[++a];
+        } else if (arg == "--csv" && a + 1 < argc) {
+            csv_path = argv[++a];
+        } else {
+            std::cerr << "Uso: " << argv[0] << " [--instances K] [--max-teams N] [--seed S] [--out engine_model.txt] [--csv medições.csv]\n";
+            return 1;
+        }
+    }
+
+    // Ligas da grade (times x rodadas x alpha x bias) que chegam às componentes, como no
+    // caminho de team1_can_win: o pré-filtro e a redução vêm antes, fora da medição
+    TournamentGenerator generator(seed);
+    GeneratorParams params;
+    Tournament tournament;
+    std::vector<Sample> samples;
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (int teams = 10; teams <= max_teams; teams *= 2) {
+        for (int rounds : {1, 3, 10, 30}) {
+            for (double alpha : {0.5, 0.7, 0.9}) {
+                for (double bias : {-0.3, -0.15, 0.0, 0.15, 0.3}) {
+                    params = {teams, rounds, alpha, bias};
+                    for (int k = 0; k < instances; ++k) {
+                        generator.generate(params, tournament);
+                        if (elimination_prefilter(tournament) == PrefilterResult::ELIMINATED) continue;
+                        ReducedNetwork reduced = presolve_tournament(tournament);
+                        if (reduced.cant_be_champion) continue;
+                        for (const ReducedNetwork& part : split_components(reduced)) {
+                            Sample sample;
+                            time_engines(part, sample);
+                            samples.push_back(sample);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    if (samples.empty()) {
+        std::cerr << "erro: nenhuma rede chegou ao fluxo\n";
+        return 1;
+    }
+
+    int disagreements = 0;
+    for (const Sample& s : samples) {
+        for (int e = 1; e < DECISION_ENGINES; ++e) disagreements += s.saturates[e] != s.saturates[0];
+    }
+    if (disagreements > 0) {
+        std::cerr << "erro: " << disagreements << " resposta(s) divergentes entre motores\n";
+        return 1;
+    }
+
+    EngineModel model;
+    for (int e = 0; e < DECISION_ENGINES; ++e) model.set(ENGINES[e], fit(samples, e));
+    if (!model.save(out_path)) {
+        std::cerr << "erro: não foi possível escrever " << out_path << "\n";
+        return 1;
+    }
+
+    if (!csv_path.empty()) {
+        std::ofstream csv(csv_path);
+        csv << "n,m,C,max_degree,fan_out,capacity_scaling_ms,edmonds_karp_ms,dinic_ms,auto\n";
+        for (const Sample& s : samples) {
+            const NetworkFeatures& f = s.features;
+            csv << f.nodes << ',' << f.arcs << ',' << f.capacity << ',' << f.max_degree << ',' << f.fan_out;
+            for (double ms : s.ms) csv << ',' << ms;
+            csv << ',' << decision_engine_name(model.choose(f)) << '\n';
+        }
+    }
+
+    // Tempo total de cada motor fixo, do auto e do melhor motor por rede (nas mesmas redes)
+    double fixed_total[DECISION_ENGINES] = {};
+    double auto_total = 0.0, oracle_total = 0.0;
+    int auto_hits = 0;
+    for (const Sample& s : samples) {
+        const int best = std::min_element(s.ms, s.ms + DECISION_ENGINES) - s.ms;
+        const int chosen = static_cast<int>(model.choose(s.features));
+        for (int e = 0; e < DECISION_ENGINES; ++e) fixed_total[e] += s.ms[e];
+        auto_total += s.ms[chosen];
+        oracle_total += s.ms[best];
+        auto_hits += chosen == best;
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+    std::cout << samples.size() << " redes medidas em " << elapsed.count() << " s; coeficientes em " << out_path
+              << " (bin/tournament --engine auto --engine-model " << out_path << ")\n";
+    for (int e = 0; e < DECISION_ENGINES; ++e) {
+        std::cout << "  " << decision_engine_name(ENGINES[e]) << ": " << fixed_total[e] << " ms\n";
+    }
+    std::cout << "  auto: " << auto_total << " ms (melhor motor em " << 100.0 * auto_hits / samples.size()
+              << "% das redes)\n"
+              << "  melhor por rede: " << oracle_total << " ms\n";
+    return 0;
+}
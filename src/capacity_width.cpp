@@ -0,0 +1,27 @@
+#include "capacity_width.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <limits>
+
+CapacityWidth choose_capacity_width(const CapacityBounds& bounds) {
+    // Flow sums are at least int wide, so only the arc capacities limit COMPACT
+    if (bounds.total <= INT_MAX) {
+        if (bounds.max_capacity < std::numeric_limits<int16_t>::max() / 2) return CapacityWidth::COMPACT;
+        if (bounds.max_capacity < INT_MAX / 2) return CapacityWidth::INT;
+    }
+    return CapacityWidth::WIDE;
+}
+
+CapacityBounds capacity_bounds(const ReducedNetwork& net) {
+    CapacityBounds bounds;
+    for (const Fixture& f : net.fixtures) {
+        bounds.max_capacity = std::max<long long>(bounds.max_capacity, f.games);
+        bounds.total += f.games;
+    }
+    for (int slack : net.slack) {
+        bounds.max_capacity = std::max<long long>(bounds.max_capacity, slack);
+    }
+    return bounds;
+}
+
@@ -0,0 +1,87 @@
+#include "certificate.hpp"
+#include "prefilter.hpp"
+#include "graph.hpp"
+#include "ford_fulkerson.hpp"
+#include "warm_start.hpp"
+#include "find_path_headers/capacity_scaling.hpp"
+#include <algorithm>
+
+bool find_elimination_certificate(const Tournament& t, EliminationCertificate& cert) {
+    std::vector<int> teams;
+    if (elimination_prefilter(t, &teams) == PrefilterResult::ELIMINATED) {
+        std::sort(teams.begin(), teams.end());
+        return verify_elimination_certificate(t, teams, &cert);
+    }
+
+    // No single team outruns team 1 here, so no sink capacity was clamped
+    Graph graph;
+    graph.fromTournament(t);
+    const int s = graph.get_source();
+    const int sink = graph.get_sink();
+    greedy_warm_start(graph, s, sink);
+    FFStats stats;
+    if (ford_fulkerson(graph, s, sink, capacity_scaling_path, AlgorithmType::CAPACITY_SCALING, &stats)
+        == graph.total_out_capacity(s)) {
+        return false;
+    }
+
+    std::vector<char> reached(graph.size(), 0);
+    std::vector<int> queue{s};
+    reached[s] = 1;
+    for (size_t head = 0; head < queue.size(); ++head) {
+        for (const auto& e : graph.adj(queue[head])) {
+            if (e.remaining_capacity() > 0 && !reached[e.to]) {
+                reached[e.to] = 1;
+                queue.push_back(e.to);
+            }
+        }
+    }
+
+    // Team i >= 1 is node team_start + i - 1 (see Graph::fromTournament)
+    int game_nodes = 0;
+    for (const Fixture& f : t.fixtures) game_nodes += f.i > 0;
+    const int team_start = 1 + game_nodes;
+    teams.clear();
+    for (int i = 1; i < t.n; ++i) {
+        if (reached[team_start + i - 1]) teams.push_back(i);
+    }
+    return verify_elimination_certificate(t, teams, &cert);
+}
+
+bool verify_elimination_certificate(const Tournament& t, const std::vector<int>& teams,
+                                    EliminationCertificate* cert) {
+    if (teams.empty()) return false;
+    for (size_t a = 0; a < teams.size(); ++a) {
+        if (teams[a] < 1 || teams[a] >= t.n) return false;
+        for (size_t b = 0; b < a; ++b) {
+            if (teams[a] == teams[b]) return false;
+        }
+    }
+
+    // Team 1's fixtures come first in (i, j) order
+    int max_wins = t.w[0];
+    for (size_t k = 0; k < t.fixtures.size() && t.fixtures[k].i == 0; ++k) max_wins += t.fixtures[k].games;
+
+    auto games_between = [&](int i, int j) {
+        if (i > j) std::swap(i, j);
+        auto it = std::lower_bound(t.fixtures.begin(), t.fixtures.end(), Fixture{i, j, 0},
+                                   [](const Fixture& a, const Fixture& b) {
+                                       return a.i != b.i ? a.i < b.i : a.j < b.j;
+                                   });
+        return it != t.fixtures.end() && it->i == i && it->j == j ? it->games : 0;
+    };
+
+    long long games = 0, slack = 0;
+    for (size_t a = 0; a < teams.size(); ++a) {
+        slack += max_wins - t.w[teams[a]] - 1;
+        for (size_t b = a + 1; b < teams.size(); ++b) games += games_between(teams[a], teams[b]);
+    }
+
+    if (cert) {
+        cert->teams = teams;
+        std::sort(cert->teams.begin(), cert->teams.end());
+        cert->games = games;
+        cert->slack = slack;
+    }
+    return games > slack;
+}
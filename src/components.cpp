@@ -0,0 +1,187 @@
+#include "components.hpp"
+#include "graph.hpp"
+#include "thread_pool.hpp"
+#include "reorder.hpp"
+#include "arena.hpp"
+#include "capacity_width.hpp"
+#include "prefilter.hpp"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <numeric>
+
+namespace {
+    // Union-find with path halving and union by size
+    struct DisjointSets {
+        std::vector<int> parent;
+        std::vector<int> size;
+
+        explicit DisjointSets(int n) : parent(n), size(n, 1) {
+            std::iota(parent.begin(), parent.end(), 0);
+        }
+
+        int find(int v) {
+            while (parent[v] != v) {
+                parent[v] = parent[parent[v]];
+                v = parent[v];
+            }
+            return v;
+        }
+
+        void unite(int a, int b) {
+            a = find(a);
+            b = find(b);
+            if (a == b) return;
+            if (size[a] < size[b]) std::swap(a, b);
+            parent[b] = a;
+            size[a] += size[b];
+        }
+    };
+
+    template <typename Cap>
+    bool component_saturates(const ReducedNetwork& part, NodeOrder node_order, DecisionEngine engine,
+                             const EngineModel& model, bool warm_start, Arena& arena, ComponentStats& work) {
+        BasicGraph<Cap> graph(0, &arena);
+        graph.fromReduced(part);
+        if (graph.get_cant_be_champion()) return false;
+        reorder_graph(graph, node_order);
+
+        static thread_local FFStats stats; // Keeps its per-iteration buffers between components
+        stats.clear();
+        const bool saturates = run_decision_engine(graph, engine, model, warm_start, &stats);
+
+        const int s = graph.get_source();
+        ++work.components;
+        work.flow += graph.net_out_flow(s);
+        work.capacity += graph.total_out_capacity(s);
+        work.iterations += stats.iterations;
+        work.nodes += graph.size();
+        work.arcs += graph.num_edges();
+        return saturates;
+    }
+
+    // Builds the component with the narrowest capacity type its games and slacks fit in
+    bool component_saturates(const ReducedNetwork& part, NodeOrder node_order, DecisionEngine engine,
+                             const EngineModel& model, bool warm_start, Arena& arena, ComponentStats& work) {
+        switch (choose_capacity_width(capacity_bounds(part))) {
+            case CapacityWidth::COMPACT: return component_saturates<int16_t>(part, node_order, engine, model, warm_start, arena, work);
+            case CapacityWidth::INT:     return component_saturates<int>(part, node_order, engine, model, warm_start, arena, work);
+            default:                     return component_saturates<long long>(part, node_order, engine, model, warm_start, arena, work);
+        }
+    }
+}
+
+std::vector<ReducedNetwork> split_components(const ReducedNetwork& net) {
+    const int k = net.slack.size();
+    DisjointSets sets(k);
+    for (const Fixture& f : net.fixtures) sets.unite(f.i, f.j);
+
+    // Component id per root, only for nodes that play at least one game
+    std::vector<char> plays(k, 0);
+    for (const Fixture& f : net.fixtures) plays[f.i] = plays[f.j] = 1;
+
+    std::vector<int> component_of_root(k, -1);
+    std::vector<int> local_id(k, -1);
+    std::vector<ReducedNetwork> parts;
+
+    for (int v = 0; v < k; ++v) {
+        if (!plays[v]) continue;
+        int root = sets.find(v);
+        if (component_of_root[root] == -1) {
+            component_of_root[root] = parts.size();
+            parts.emplace_back();
+            parts.back().cant_be_champion = net.cant_be_champion;
+        }
+        ReducedNetwork& part = parts[component_of_root[root]];
+        local_id[v] = part.slack.size();
+        part.slack.push_back(net.slack[v]);
+        part.members.push_back(net.members[v]);
+    }
+
+    for (const Fixture& f : net.fixtures) {
+        ReducedNetwork& part = parts[component_of_root[sets.find(f.i)]];
+        part.fixtures.push_back({local_id[f.i], local_id[f.j], f.games});
+    }
+
+    return parts;
+}
+
+ComponentSolver::ComponentSolver(int threads, NodeOrder node_order, DecisionEngine engine, EngineModel model,
+                                 bool warm_start)
+    : threads(threads > 0 ? threads : ThreadPool::default_threads()), node_order(node_order), engine(engine),
+      model(model), warm_start(warm_start) {}
+
+ComponentSolver::~ComponentSolver() = default;
+
+bool ComponentSolver::all_saturate(const std::vector<ReducedNetwork>& parts, ComponentStats* stats) {
+    // Largest components first, so the long solves start early
+    std::vector<int> order(parts.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return parts[a].fixtures.size() > parts[b].fixtures.size();
+    });
+
+    std::atomic<bool> eliminated{false};
+    std::atomic<size_t> cursor{0};
+
+    const int workers = std::min<int>(threads, parts.size());
+
+    // One arena per worker holds the network being solved; it is reset after each component
+    // and kept for the next call, so its pages are already mapped
+    while (static_cast<int>(arenas.size()) < std::max(workers, 1)) {
+        arenas.push_back(std::make_unique<Arena>());
+    }
+
+    // Summed per worker, merged after the run
+    std::vector<ComponentStats> work(std::max(workers, 1));
+
+    auto worker = [&](int tid) {
+        Arena& arena = *arenas[tid];
+        while (!eliminated.load(std::memory_order_relaxed)) {
+            size_t k = cursor.fetch_add(1);
+            if (k >= order.size()) return;
+            bool saturates = component_saturates(parts[order[k]], node_order, engine, model, warm_start, arena, work[tid]);
+            arena.release();
+            if (!saturates) {
+                eliminated.store(true);
+            }
+        }
+    };
+
+    if (workers <= 1) {
+        worker(0);
+    } else {
+        // Started on the first call that has work for several threads
+        if (!pool) pool = std::make_unique<ThreadPool>(threads);
+        pool->run([&](int tid) {
+            if (tid < workers) worker(tid);
+        });
+    }
+
+    if (stats) {
+        *stats = ComponentStats();
+        for (const ComponentStats& w : work) {
+            stats->components += w.components;
+            stats->flow += w.flow;
+            stats->capacity += w.capacity;
+            stats->iterations += w.iterations;
+            stats->nodes += w.nodes;
+            stats->arcs += w.arcs;
+        }
+    }
+    return !eliminated.load();
+}
+
+bool all_components_saturate(const std::vector<ReducedNetwork>& parts, int threads, NodeOrder node_order,
+                             DecisionEngine engine, bool warm_start) {
+    ComponentSolver solver(threads, node_order, engine, EngineModel(), warm_start);
+    return solver.all_saturate(parts);
+}
+
+bool team1_can_win(const Tournament& tournament, ComponentSolver& solver, ComponentStats* stats) {
+    if (stats) *stats = ComponentStats();
+    if (elimination_prefilter(tournament) == PrefilterResult::ELIMINATED) return false;
+
+    ReducedNetwork reduced = presolve_tournament(tournament);
+    return !reduced.cant_be_champion && solver.all_saturate(split_components(reduced), stats);
+}
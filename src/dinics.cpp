@@ -1,25 +1,57 @@
 #include "dinics.hpp"
+#include "arc_scan.hpp"
+#include "arena.hpp"
+#include "find_path_headers/bfs_hybrid.hpp"
+#include "find_path_headers/bfs_parallel.hpp"
 #include <vector>
-#include <queue>
 #include <algorithm>
+#include <limits>
+#include <type_traits>
 
 // Builds level graph using BFS from source
-bool bfs_level(const Graph& graph, std::vector<int>& level, int s, int t) {
+template <typename Cap>
+bool bfs_level(const BasicGraph<Cap>& graph, std::vector<int>& level, int s, int t) {
+    static thread_local ArcMasks masks; // Reused across calls to avoid reallocating the bitmasks
+
     int n = graph.size();
     level.assign(n, -1);
     level[s] = 0;
 
-    std::queue<int> q;
-    q.push(s);
+    // Flat FIFO from the scratch arena: every node is enqueued at most once
+    Arena& scratch = scratch_arena();
+    scratch.release();
+    int* queue = scratch.allocate_array<int>(n);
+    int head = 0, tail = 0;
+    queue[tail++] = s;
+
+    while (head < tail) {
+        int u = queue[head++];
+
+        const auto& neighbors = graph.get_neighbors(u);
+        const int degree = neighbors.size();
 
-    while (!q.empty()) {
-        int u = q.front(); q.pop();
+        if (!ArcMasks::pays_off(degree)) {
+            for (const auto& e : neighbors) {
+                // Only consider forward edges with remaining capacity
+                if (e.capacity - e.flow > 0 && level[e.to] == -1) {
+                    level[e.to] = level[u] + 1;
+                    queue[tail++] = e.to;
+                }
+            }
+            continue;
+        }
 
-        for (const Edge& e : graph.get_neighbors(u)) {
-            // Only consider forward edges with remaining capacity
-            if (e.capacity - e.flow > 0 && level[e.to] == -1) {
-                level[e.to] = level[u] + 1;
-                q.push(e.to);
+        // Long list: only consider edges with remaining capacity (found by one vectorized pass)
+        masks.scan(neighbors, 1);
+        for (int w = 0; w * 64 < degree; ++w) {
+            uint64_t bits = masks.admissible[w];
+            while (bits) {
+                const auto& e = neighbors[w * 64 + __builtin_ctzll(bits)];
+                bits &= bits - 1;
+                if (level[e.to] == -1) {
+                    level[e.to] = level[u] + 1;
+                    queue[tail++] = e.to;
+                }
             }
         }
     }
@@ -29,7 +61,8 @@ bool bfs_level(const Graph& graph, std::vector<int>& level, int s, int t) {
 }
 
 // DFS to send flow through level graph
-int dfs_flow(Graph& graph, std::vector<int>& level, std::vector<int>& ptr, int u, int t, int pushed) {
+template <typename Cap>
+Cap dfs_flow(BasicGraph<Cap>& graph, std::vector<int>& level, std::vector<int>& ptr, int u, int t, Cap pushed) {
     if (pushed == 0) return 0;
     if (u == t) return pushed;
 
@@ -37,11 +70,11 @@ int dfs_flow(Graph& graph, std::vector<int>& level, std::vector<int>& ptr, int u
 
     // Try all edges starting from ptr[u]
     for (int& cid = ptr[u]; cid < (int)adj[u].size(); ++cid) {
-        Edge& e = adj[u][cid];
+        auto& e = adj[u][cid];
         // Follow only valid level edges with capacity
         if (level[e.to] != level[u] + 1 || e.capacity - e.flow <= 0) continue;
 
-        int tr = dfs_flow(graph, level, ptr, e.to, t, std::min(pushed, e.capacity - e.flow));
+        Cap tr = dfs_flow(graph, level, ptr, e.to, t, std::min<Cap>(pushed, e.capacity - e.flow));
         if (tr == 0) continue;
 
         // Push flow and update reverse edge
@@ -54,19 +87,35 @@ int dfs_flow(Graph& graph, std::vector<int>& level, std::vector<int>& ptr, int u
 }
 
 // Computes max flow using Dinic's algorithm
-int dinic_max_flow(Graph& graph, int s, int t) {
-    int flow = 0;
-    std::vector<int> level;
-    std::vector<int> ptr;
+template <typename Cap>
+FlowSum<Cap> dinic_max_flow(BasicGraph<Cap>& graph, int s, int t, LevelBfs level_bfs) {
+    FlowSum<Cap> flow = graph.net_out_flow(s); // Non-zero when the graph was warm-started
+    static thread_local std::vector<int> level; // Reused between runs, like the finders' buffers
+    static thread_local std::vector<int> ptr;
 
     // Rebuild level graph and find blocking flow repeatedly
-    while (bfs_level(graph, level, s, t)) {
+    auto build_levels = [&]() {
+        if constexpr (std::is_same_v<Cap, int>) {
+            switch (level_bfs) {
+                case LevelBfs::DIRECTION_OPTIMIZING: return hybrid_bfs(graph, s, t, level, nullptr, true);
+                case LevelBfs::PARALLEL:             return parallel_bfs(graph, s, t, level, nullptr, true);
+                default:                             break;
+            }
+        }
+        return bfs_level(graph, level, s, t);
+    };
+
+    while (build_levels()) {
         ptr.assign(graph.size(), 0);
 
-        while (int pushed = dfs_flow(graph, level, ptr, s, t, 1e9)) {
+        while (Cap pushed = dfs_flow(graph, level, ptr, s, t, std::numeric_limits<Cap>::max())) {
             flow += pushed;
         }
     }
 
     return flow;
 }
+
+template FlowSum<int16_t> dinic_max_flow<int16_t>(BasicGraph<int16_t>&, int, int, LevelBfs);
+template FlowSum<int> dinic_max_flow<int>(BasicGraph<int>&, int, int, LevelBfs);
+template FlowSum<long long> dinic_max_flow<long long>(BasicGraph<long long>&, int, int, LevelBfs);
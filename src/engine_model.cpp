@@ -0,0 +1,168 @@
+#include "engine_model.hpp"
+#include "ford_fulkerson.hpp"
+#include "dinics.hpp"
+#include "warm_start.hpp"
+#include "find_path_headers/bfs.hpp"
+#include "find_path_headers/capacity_scaling.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+    const DecisionEngine CONCRETE[DECISION_ENGINES] = {
+        DecisionEngine::CAPACITY_SCALING, DecisionEngine::EDMONDS_KARP, DecisionEngine::DINIC
+    };
+}
+
+DecisionEngine parse_decision_engine(const std::string& name) {
+    if (name == "capacity_scaling") return DecisionEngine::CAPACITY_SCALING;
+    if (name == "edmonds_karp") return DecisionEngine::EDMONDS_KARP;
+    if (name == "dinic") return DecisionEngine::DINIC;
+    if (name == "auto") return DecisionEngine::AUTO;
+    throw std::invalid_argument("Unknown engine: " + name);
+}
+
+const char* decision_engine_name(DecisionEngine engine) {
+    switch (engine) {
+        case DecisionEngine::CAPACITY_SCALING: return "capacity_scaling";
+        case DecisionEngine::EDMONDS_KARP:     return "edmonds_karp";
+        case DecisionEngine::DINIC:            return "dinic";
+        default:                               return "auto";
+    }
+}
+
+template <typename Cap>
+NetworkFeatures network_features(const BasicGraph<Cap>& graph) {
+    const Cap unbounded = std::numeric_limits<Cap>::max() / 2; // Game-to-team arcs of fromReduced
+    NetworkFeatures f;
+    f.nodes = graph.size();
+    f.arcs = graph.num_edges();
+    for (int u = 0; u < f.nodes; ++u) {
+        const auto& arcs = graph.adj(u);
+        f.max_degree = std::max(f.max_degree, static_cast<int>(arcs.size()));
+        for (const auto& e : arcs) {
+            if (e.id >= 0 && e.capacity < unbounded) f.capacity = std::max<long long>(f.capacity, e.capacity);
+        }
+    }
+    if (f.nodes > 0) f.fan_out = static_cast<double>(graph.adj(graph.get_source()).size()) / f.nodes;
+    return f;
+}
+
+EngineModel::Coefficients EngineModel::model_terms(const NetworkFeatures& f) {
+    return {1.0,
+            std::log(std::max(f.nodes, 1)),
+            std::log(std::max(f.arcs, 1)),
+            std::log1p(static_cast<double>(std::max(f.capacity, 0LL))),
+            std::log(std::max(f.max_degree, 1)),
+            f.fan_out};
+}
+
+EngineModel::EngineModel() {
+    // Fitted by bin/bench_engines with its default grid and seed; a file it writes with
+    // other settings or on another machine replaces them through load()
+    coef[0] = {-10.5954, 1.41662, -0.0782255, 0.117516, 0.53606, -0.98752};
+    coef[1] = {-10.757, 1.51336, -0.0409269, 0.0417687, 0.532241, -1.09154};
+    coef[2] = {-9.463, 0.346185, 0.296613, -0.0365546, 0.328853, -0.121838};
+}
+
+bool EngineModel::load(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) return false;
+
+    std::array<Coefficients, DECISION_ENGINES> loaded = coef;
+    std::string line;
+    while (std::getline(in, line)) {
+        std::istringstream fields(line);
+        std::string name;
+        if (!(fields >> name) || name[0] == '#') continue;
+
+        DecisionEngine engine;
+        try {
+            engine = parse_decision_engine(name);
+        } catch (const std::invalid_argument&) {
+            return false;
+        }
+        if (engine == DecisionEngine::AUTO) return false;
+
+        Coefficients c;
+        for (double& x : c) {
+            if (!(fields >> x)) return false;
+        }
+        loaded[static_cast<int>(engine)] = c;
+    }
+    coef = loaded;
+    return true;
+}
+
+bool EngineModel::save(const std::string& path) const {
+    std::ofstream out(path, std::ios::trunc);
+    out << "# ln(ms) = c0 + c1 ln(n) + c2 ln(m) + c3 ln(C+1) + c4 ln(max degree) + c5 fan-out\n"
+        << "# engine c0 c1 c2 c3 c4 c5 (written by bin/bench_engines)\n"
+        << std::setprecision(6);
+    for (DecisionEngine engine : CONCRETE) {
+        out << decision_engine_name(engine);
+        for (double x : coef[static_cast<int>(engine)]) out << ' ' << x;
+        out << '\n';
+    }
+    out.close();
+    return static_cast<bool>(out);
+}
+
+void EngineModel::set(DecisionEngine engine, const Coefficients& coefficients) {
+    coef[static_cast<int>(engine)] = coefficients;
+}
+
+double EngineModel::predict(DecisionEngine engine, const NetworkFeatures& f) const {
+    const Coefficients terms = model_terms(f);
+    const Coefficients& c = coef[static_cast<int>(engine)];
+    double y = 0.0;
+    for (int k = 0; k < TERMS; ++k) y += c[k] * terms[k];
+    return y;
+}
+
+DecisionEngine EngineModel::choose(const NetworkFeatures& f) const {
+    DecisionEngine best = DecisionEngine::CAPACITY_SCALING;
+    double best_cost = std::numeric_limits<double>::infinity();
+    for (DecisionEngine engine : CONCRETE) {
+        const double cost = predict(engine, f);
+        if (cost < best_cost) {
+            best_cost = cost;
+            best = engine;
+        }
+    }
+    return best;
+}
+
+template <typename Cap>
+bool run_decision_engine(BasicGraph<Cap>& graph, DecisionEngine engine, const EngineModel& model,
+                         bool warm_start, FFStats* stats) {
+    if (engine == DecisionEngine::AUTO) engine = model.choose(network_features(graph));
+
+    const int s = graph.get_source();
+    const int t = graph.get_sink();
+    if (warm_start) greedy_warm_start(graph, s, t);
+
+    FFStats local;
+    if (!stats) stats = &local;
+    switch (engine) {
+        case DecisionEngine::EDMONDS_KARP:
+            return ford_fulkerson_saturates(graph, s, t, bfs_path<Cap>, AlgorithmType::BFS_EDMONDS_KARP, stats);
+        case DecisionEngine::DINIC:
+            return dinic_max_flow(graph, s, t) == graph.total_out_capacity(s);
+        default:
+            return ford_fulkerson_saturates(graph, s, t, capacity_scaling_path<Cap>,
+                                            AlgorithmType::CAPACITY_SCALING, stats);
+    }
+}
+
+#define INSTANTIATE_ENGINE_MODEL(Cap) \
+    template NetworkFeatures network_features<Cap>(const BasicGraph<Cap>&); \
+    template bool run_decision_engine<Cap>(BasicGraph<Cap>&, DecisionEngine, const EngineModel&, bool, FFStats*);
+
+INSTANTIATE_ENGINE_MODEL(int16_t)
+INSTANTIATE_ENGINE_MODEL(int)
+INSTANTIATE_ENGINE_MODEL(long long)
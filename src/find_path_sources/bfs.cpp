@@ -1,13 +1,27 @@
 #include "find_path_headers/bfs.hpp"
-#include <queue>
+#include "arc_scan.hpp"
+#include "arena.hpp"
 #include <algorithm>
 
-bool bfs_path(const Graph& graph, int s, int t, Path& path, FFStats* stats) {
+namespace {
+    thread_local ArcMasks masks_buffer; // Reused across calls to avoid reallocating the bitmasks
+}
+
+template <typename Cap>
+bool bfs_path(const BasicGraph<Cap>& graph, int s, int t, Path& path, FFStats* stats) {
     int n = graph.size();
     bfs_state::reset(n);  // Prepare visited array and increment token
-
-    std::vector<std::pair<int, int>> parent(n, {-1, -1}); // Stores how each node was reached
-    std::queue<int> q;
+    uint64_t* visited = bfs_state::visited.data();
+    const uint64_t token = bfs_state::visitedToken;
+    ArcMasks& masks = masks_buffer; // Resolve the thread_local once, not per node
+
+    // Per-search arrays from the scratch arena: parent links (only read along the final
+    // path, so left uninitialized) and a flat FIFO (every node is enqueued at most once)
+    Arena& scratch = scratch_arena();
+    scratch.release();
+    auto* parent = scratch.allocate_array<std::pair<int, int>>(n); // Stores how each node was reached
+    int* queue = scratch.allocate_array<int>(n);
+    int head = 0, tail = 0;
 
     int visited_nodes = 1; // source is initially visited
     int visited_arcs_residual = 0;
@@ -17,39 +31,71 @@ bool bfs_path(const Graph& graph, int s, int t, Path& path, FFStats* stats) {
     //std::cerr << "Initial residual graph:" << std::endl;
     //graph.print_residual_graph(); // Print the initial graph
 
-    q.push(s);
-    bfs_state::visited[s] = bfs_state::visitedToken; // Mark source as visited for this iteration
+    queue[tail++] = s;
+    visited[s] = token; // Mark source as visited for this iteration
 
 	bool found = false;
 
     // Standard BFS loop to find an s-t path with positive residual capacity
-    while (!q.empty()&& !found) {
-        int u = q.front();
-        q.pop();
+    while (head < tail && !found) {
+        int u = queue[head++];
 
         ++visited_nodes;
         const auto& neighbors = graph.get_neighbors(u);
-
-        for (size_t i = 0; i < neighbors.size(); ++i) {
-            const Edge& e = neighbors[i];
-            
-            if(e.capacity > 0){
-                ++visited_arcs_forward;
+        const int degree = neighbors.size();
+
+        if (!ArcMasks::pays_off(degree)) {
+            for (int i = 0; i < degree; ++i) {
+                const auto& e = neighbors[i];
+
+                if (e.capacity > 0) {
+                    ++visited_arcs_forward;
+                }
+                ++visited_arcs_residual;
+
+                // Skip visited nodes or saturated edges
+                if (visited[e.to] != token && e.capacity > e.flow) {
+                    visited[e.to] = token;
+                    parent[e.to] = {u, i};
+                    queue[tail++] = e.to;
+                    if (e.to == t) {
+                        found = true;
+                        break;
+                    }
+                }
             }
-            ++visited_arcs_residual;
-
-            // Skip visited nodes or saturated edges
-            if (bfs_state::visited[e.to] != bfs_state::visitedToken && e.capacity > e.flow) {
-                bfs_state::visited[e.to] = bfs_state::visitedToken;
-                parent[e.to] = {u, static_cast<int>(i)};
-                q.push(e.to);
-                if (e.to == t) {
-					found = true;
-					break;
-				}
+            continue;
+        }
+
+        // Long list: one vectorized pass marks the arcs with residual capacity; only those are visited
+        masks.scan(neighbors, 1);
+
+        int stop = degree - 1; // Last arc inspected (all of them unless t is found)
+        for (int w = 0; w * 64 < degree && !found; ++w) {
+            uint64_t bits = masks.admissible[w];
+            while (bits) {
+                int i = w * 64 + __builtin_ctzll(bits);
+                bits &= bits - 1;
+
+                const auto& e = neighbors[i];
+
+                // Skip visited nodes (saturated edges were already filtered out)
+                if (visited[e.to] != token) {
+                    visited[e.to] = token;
+                    parent[e.to] = {u, i};
+                    queue[tail++] = e.to;
+                    if (e.to == t) {
+                        found = true;
+                        stop = i;
+                        break;
+                    }
+                }
             }
         }
 
+        visited_arcs_residual += stop + 1;
+        visited_arcs_forward += ArcMasks::count_upto(masks.forward, stop);
+
         //std::cerr << "Tô entrando no loop"<< std::endl;
     }
 
@@ -58,7 +104,7 @@ bool bfs_path(const Graph& graph, int s, int t, Path& path, FFStats* stats) {
     stats->visited_residual_arcs_per_iter.push_back(visited_arcs_residual);
 
     // Sink wasn't reached => no augmenting path
-    if (bfs_state::visited[t] != bfs_state::visitedToken){
+    if (visited[t] != token){
         //std::cerr << "n achei path"<< std::endl;
         return false;
     }
@@ -75,3 +121,7 @@ bool bfs_path(const Graph& graph, int s, int t, Path& path, FFStats* stats) {
 
     return true;
 }
+
+template bool bfs_path<int16_t>(const BasicGraph<int16_t>&, int, int, Path&, FFStats*);
+template bool bfs_path<int>(const BasicGraph<int>&, int, int, Path&, FFStats*);
+template bool bfs_path<long long>(const BasicGraph<long long>&, int, int, Path&, FFStats*);
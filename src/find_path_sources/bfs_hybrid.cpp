@@ -0,0 +1,170 @@
+#include "find_path_headers/bfs_hybrid.hpp"
+#include "arc_scan.hpp"
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+    // Beamer et al. switching thresholds
+    constexpr int ALPHA = 14; // go bottom-up when frontier arcs > unexplored arcs / ALPHA
+    constexpr int BETA = 24;  // go back top-down when frontier nodes < n / BETA
+
+    thread_local std::vector<uint64_t> frontier;
+    thread_local std::vector<uint64_t> next;
+    thread_local std::vector<int> frontier_list; // frontier as a list, for top-down steps
+    thread_local std::vector<int> next_list;
+    thread_local std::vector<int> unvisited;     // nodes still unreached, compacted on bottom-up steps
+    thread_local std::vector<std::pair<int, int>> parent_buffer;
+    thread_local std::vector<int> level_buffer;
+    thread_local ArcMasks masks;
+
+    inline bool test(const std::vector<uint64_t>& bits, int v) {
+        return (bits[v >> 6] >> (v & 63)) & 1;
+    }
+
+    inline void set(std::vector<uint64_t>& bits, int v) {
+        bits[v >> 6] |= uint64_t(1) << (v & 63);
+    }
+}
+
+bool hybrid_bfs(const Graph& graph, int s, int t, std::vector<int>& level,
+                std::vector<std::pair<int, int>>* parent, bool stop_at_t, BfsCounters* counters) {
+    const int n = graph.size();
+    const int words = (n + 63) / 64;
+
+    level.assign(n, -1);
+    if (parent) parent->assign(n, {-1, -1});
+    frontier.assign(words, 0);
+    next.assign(words, 0);
+    frontier_list.clear();
+
+    BfsCounters local;
+
+    // Arcs leaving still-unvisited nodes (bottom-up cost estimate)
+    long long unexplored_arcs = 0;
+    for (int v = 0; v < n; ++v) unexplored_arcs += graph.get_neighbors(v).size();
+
+    unvisited.clear();
+    for (int v = 0; v < n; ++v) {
+        if (v != s) unvisited.push_back(v);
+    }
+
+    level[s] = 0;
+    set(frontier, s);
+    frontier_list.push_back(s);
+    unexplored_arcs -= graph.get_neighbors(s).size();
+    local.visited_nodes = 1;
+
+    long long frontier_arcs = graph.get_neighbors(s).size();
+    bool bottom_up = false;
+    int depth = 0;
+
+    bool reached_t = false;
+
+    while (!frontier_list.empty() && !reached_t) {
+        // Pick the direction for this level
+        if (!bottom_up && frontier_arcs > unexplored_arcs / ALPHA) {
+            bottom_up = true;
+        } else if (bottom_up && static_cast<long long>(frontier_list.size()) < n / BETA) {
+            bottom_up = false;
+        }
+
+        std::fill(next.begin(), next.end(), 0);
+        next_list.clear();
+        frontier_arcs = 0;
+
+        if (!bottom_up) {
+            // Top-down: scan the arcs of every frontier node
+            for (int u : frontier_list) {
+                if (reached_t) break;
+                const auto& neighbors = graph.get_neighbors(u);
+                const int degree = neighbors.size();
+                masks.scan(neighbors, 1);
+
+                local.visited_arcs_residual += degree;
+                local.visited_arcs_forward += masks.count_all(masks.forward);
+
+                for (int w = 0; w * 64 < degree; ++w) {
+                    uint64_t bits = masks.admissible[w];
+                    while (bits) {
+                        int i = w * 64 + __builtin_ctzll(bits);
+                        bits &= bits - 1;
+                        int v = neighbors[i].to;
+                        if (level[v] != -1) continue;
+                        level[v] = depth + 1;
+                        if (parent) (*parent)[v] = {u, i};
+                        set(next, v);
+                        next_list.push_back(v);
+                        if (stop_at_t && v == t) {
+                            reached_t = true;
+                            break;
+                        }
+                    }
+                    if (reached_t) break;
+                }
+            }
+        } else {
+            // Bottom-up: every unvisited node looks for a residual arc coming from the frontier.
+            // adj[v][k] is the reverse of u->v, which lives at adj[u][adj[v][k].rev].
+            size_t kept = 0;
+            for (size_t k = 0; k < unvisited.size(); ++k) {
+                int v = unvisited[k];
+                if (level[v] != -1) continue; // reached by an earlier top-down step
+
+                for (const Edge& back : graph.get_neighbors(v)) {
+                    int u = back.to;
+                    const Edge& e = graph.get_neighbors(u)[back.rev];
+                    ++local.visited_arcs_residual;
+                    if (e.capacity > 0) ++local.visited_arcs_forward;
+
+                    if (test(frontier, u) && e.remaining_capacity() > 0) {
+                        level[v] = depth + 1;
+                        if (parent) (*parent)[v] = {u, back.rev};
+                        set(next, v);
+                        next_list.push_back(v);
+                        if (stop_at_t && v == t) reached_t = true;
+                        break;
+                    }
+                }
+
+                if (reached_t) break; // the search ends here, no need to finish compacting
+                if (level[v] == -1) unvisited[kept++] = v;
+            }
+            unvisited.resize(kept);
+        }
+
+        for (int v : next_list) {
+            long long degree = graph.get_neighbors(v).size();
+            frontier_arcs += degree;
+            unexplored_arcs -= degree;
+        }
+        local.visited_nodes += next_list.size();
+
+        std::swap(frontier, next);
+        std::swap(frontier_list, next_list);
+        ++depth;
+    }
+
+    if (counters) *counters = local;
+    return level[t] != -1;
+}
+
+bool bfs_hybrid_path(const Graph& graph, int s, int t, Path& path, FFStats* stats) {
+    BfsCounters counters;
+    bool found = hybrid_bfs(graph, s, t, level_buffer, &parent_buffer, true, &counters);
+
+    stats->visited_nodes_per_iter.push_back(counters.visited_nodes);
+    stats->visited_forward_arcs_per_iter.push_back(counters.visited_arcs_forward);
+    stats->visited_residual_arcs_per_iter.push_back(counters.visited_arcs_residual);
+
+    if (!found) return false;
+
+    // Reconstruct path from t to s using parent info
+    path.clear();
+    for (int u = t; u != s; u = parent_buffer[u].first) {
+        path.push_back(parent_buffer[u]);
+    }
+    std::reverse(path.begin(), path.end());
+
+    return true;
+}
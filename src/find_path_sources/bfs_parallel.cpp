@@ -0,0 +1,188 @@
+#include "find_path_headers/bfs_parallel.hpp"
+#include "thread_pool.hpp"
+#include <atomic>
+#include <memory>
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+    constexpr int CHUNK = 512;       // Arcs per work item
+    constexpr int MIN_PARALLEL = 4;  // Below this many work items a level runs on the caller only
+
+    struct WorkItem {
+        int node;
+        int begin;
+        int end;
+    };
+
+    // Per-thread results of one level
+    struct alignas(64) LocalState {
+        std::vector<int> next;
+        BfsCounters counters;
+    };
+
+    // Buffers and pool of the thread calling parallel_bfs. Each calling thread gets its own,
+    // so independent solves can run the finder concurrently; the pool's workers only ever
+    // touch the state of the call that woke them.
+    struct ParallelBfsState {
+        int requested_threads = 0;
+        std::unique_ptr<ThreadPool> pool;
+
+        // Epoch-token visited array, claimed with compare-and-swap
+        std::unique_ptr<std::atomic<uint64_t>[]> visited;
+        size_t visited_size = 0;
+        uint64_t visitedToken = 0;
+
+        std::vector<WorkItem> items;
+        std::vector<LocalState> locals;
+        std::vector<int> frontier;
+        std::vector<int> level_buffer;
+        std::vector<std::pair<int, int>> parent_buffer;
+
+        ThreadPool& get_pool() {
+            int threads = requested_threads > 0 ? requested_threads : ThreadPool::default_threads();
+            if (!pool || pool->size() != threads) pool = std::make_unique<ThreadPool>(threads);
+            return *pool;
+        }
+
+        void reset_visited(int n) {
+            if (visited_size < static_cast<size_t>(n)) {
+                visited = std::make_unique<std::atomic<uint64_t>[]>(n);
+                for (int v = 0; v < n; ++v) visited[v].store(0, std::memory_order_relaxed);
+                visited_size = n;
+            }
+            ++visitedToken;
+        }
+    };
+
+    ParallelBfsState& caller_state() {
+        thread_local ParallelBfsState state;
+        return state;
+    }
+}
+
+void set_bfs_threads(int threads) {
+    caller_state().requested_threads = std::max(0, threads);
+}
+
+int get_bfs_threads() {
+    int requested = caller_state().requested_threads;
+    return requested > 0 ? requested : ThreadPool::default_threads();
+}
+
+bool parallel_bfs(const Graph& graph, int s, int t, std::vector<int>& level,
+                  std::vector<std::pair<int, int>>* parent, bool stop_at_t, BfsCounters* counters) {
+    const int n = graph.size();
+    // Bound here, so the workers' lambda sees the caller's state and not their own
+    ParallelBfsState& state = caller_state();
+    auto& visited = state.visited;
+    auto& items = state.items;
+    auto& locals = state.locals;
+    auto& frontier = state.frontier;
+    ThreadPool& workers = state.get_pool();
+    const int threads = workers.size();
+
+    state.reset_visited(n);
+    level.assign(n, -1);
+    if (parent) parent->assign(n, {-1, -1});
+    locals.resize(threads);
+
+    BfsCounters total;
+    total.visited_nodes = 1;
+
+    visited[s].store(state.visitedToken, std::memory_order_relaxed);
+    level[s] = 0;
+    frontier.assign(1, s);
+
+    std::atomic<bool> reached_t{false};
+    std::atomic<size_t> cursor{0};
+    int depth = 0;
+
+    // Expands the work items claimed by one thread
+    auto expand = [&](int tid) {
+        LocalState& local = locals[tid];
+        const uint64_t token = state.visitedToken;
+
+        while (true) {
+            if (stop_at_t && reached_t.load(std::memory_order_relaxed)) break;
+            size_t k = cursor.fetch_add(1, std::memory_order_relaxed);
+            if (k >= items.size()) break;
+
+            const WorkItem& item = items[k];
+            const auto& neighbors = graph.get_neighbors(item.node);
+            for (int i = item.begin; i < item.end; ++i) {
+                const Edge& e = neighbors[i];
+                ++local.counters.visited_arcs_residual;
+                if (e.capacity > 0) ++local.counters.visited_arcs_forward;
+                if (e.capacity <= e.flow) continue;
+
+                uint64_t seen = visited[e.to].load(std::memory_order_relaxed);
+                if (seen == token) continue;
+                if (!visited[e.to].compare_exchange_strong(seen, token, std::memory_order_relaxed)) continue;
+
+                // This thread owns e.to: nobody else writes its level/parent
+                level[e.to] = depth + 1;
+                if (parent) (*parent)[e.to] = {item.node, i};
+                local.next.push_back(e.to);
+                if (e.to == t) reached_t.store(true, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    while (!frontier.empty() && !(stop_at_t && reached_t.load())) {
+        // Cut the frontier into chunks of at most CHUNK arcs
+        items.clear();
+        for (int u : frontier) {
+            int degree = graph.get_neighbors(u).size();
+            for (int b = 0; b < degree; b += CHUNK) {
+                items.push_back({u, b, std::min(degree, b + CHUNK)});
+            }
+        }
+
+        for (LocalState& local : locals) {
+            local.next.clear();
+            local.counters = BfsCounters();
+        }
+        cursor.store(0);
+
+        if (threads == 1 || static_cast<int>(items.size()) < MIN_PARALLEL) {
+            expand(0);
+        } else {
+            workers.run(expand);
+        }
+
+        frontier.clear();
+        for (LocalState& local : locals) {
+            frontier.insert(frontier.end(), local.next.begin(), local.next.end());
+            total.visited_nodes += local.next.size();
+            total.visited_arcs_forward += local.counters.visited_arcs_forward;
+            total.visited_arcs_residual += local.counters.visited_arcs_residual;
+        }
+        ++depth;
+    }
+
+    if (counters) *counters = total;
+    return level[t] != -1;
+}
+
+bool bfs_parallel_path(const Graph& graph, int s, int t, Path& path, FFStats* stats) {
+    ParallelBfsState& state = caller_state();
+    std::vector<std::pair<int, int>>& parent_buffer = state.parent_buffer;
+    BfsCounters counters;
+    bool found = parallel_bfs(graph, s, t, state.level_buffer, &parent_buffer, true, &counters);
+
+    stats->visited_nodes_per_iter.push_back(counters.visited_nodes);
+    stats->visited_forward_arcs_per_iter.push_back(counters.visited_arcs_forward);
+    stats->visited_residual_arcs_per_iter.push_back(counters.visited_arcs_residual);
+
+    if (!found) return false;
+
+    // Reconstruct path from t to s using parent info
+    path.clear();
+    for (int u = t; u != s; u = parent_buffer[u].first) {
+        path.push_back(parent_buffer[u]);
+    }
+    std::reverse(path.begin(), path.end());
+
+    return true;
+}
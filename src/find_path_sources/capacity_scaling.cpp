@@ -1,13 +1,14 @@
 #include "find_path_headers/capacity_scaling.hpp"
-#include <queue>
-#include <stack>
+#include "arc_scan.hpp"
+#include "arena.hpp"
 #include <limits>
 #include <algorithm>
 #include <cmath>
 
 namespace {
-    std::vector<uint64_t> visited;
-    uint64_t visitedToken = 1;
+    thread_local std::vector<uint64_t> visited;
+    thread_local uint64_t visitedToken = 1;
+    thread_local ArcMasks masks_buffer; // Reused across calls to avoid reallocating the bitmasks
 
     void reset(size_t n) {
         if (visited.size() < n) visited.assign(n, 0);
@@ -15,11 +16,17 @@ namespace {
     }
 }
 
-static bool dfs_with_delta(const Graph& graph, int s, int t, Path& path, int delta, FFStats* stats) {
+template <typename Cap>
+static bool dfs_with_delta(const BasicGraph<Cap>& graph, int s, int t, Path& path, long long delta, FFStats* stats) {
     int n = graph.size();
-    std::vector<std::pair<int, int>> parent(n, {-1, -1});
-    std::stack<int> st;
-    st.push(s);
+    // Parent links and an explicit stack (nodes are pushed once) from the scratch arena
+    Arena& scratch = scratch_arena();
+    scratch.release();
+    ArcMasks& masks = masks_buffer; // Resolve the thread_local once, not per node
+    auto* parent = scratch.allocate_array<std::pair<int, int>>(n);
+    int* stack = scratch.allocate_array<int>(n);
+    int top = 0;
+    stack[top++] = s;
     visited[s] = visitedToken;
 
     int visited_nodes = 1;
@@ -27,31 +34,70 @@ static bool dfs_with_delta(const Graph& graph, int s, int t, Path& path, int del
     int visited_arcs_forward = 0;
     bool found = false;
 
-    while (!st.empty() && !found) {
-        int u = st.top();
-        st.pop();
+    while (top > 0 && !found) {
+        int u = stack[--top];
 
         const auto& neighbors = graph.get_neighbors(u);
-        for (size_t i = 0; i < neighbors.size() && !found; ++i) {
-            const Edge& e = neighbors[i];
-            int residual = e.remaining_capacity();
-            if (residual >= delta) {
-                if (e.capacity > 0) {
-                    ++visited_arcs_forward;
+        const int degree = neighbors.size();
+
+        if (!ArcMasks::pays_off(degree)) {
+            for (int i = 0; i < degree && !found; ++i) {
+                const auto& e = neighbors[i];
+                if (e.remaining_capacity() >= delta) {
+                    if (e.capacity > 0) {
+                        ++visited_arcs_forward;
+                    }
+                    ++visited_arcs_residual;
+
+                    if (visited[e.to] != visitedToken) {
+                        visited[e.to] = visitedToken;
+                        parent[e.to] = {u, i};
+                        stack[top++] = e.to;
+                        ++visited_nodes;
+                        if (e.to == t) {
+                            found = true;
+                        }
+                    }
                 }
-                ++visited_arcs_residual;
-                
+            }
+            continue;
+        }
+
+        // Long list, vectorized pass: only arcs with residual >= delta are looked at individually
+        masks.scan(neighbors, delta);
+
+        int stop = -1; // Arc where t was found, if any
+        for (int w = 0; w * 64 < degree && !found; ++w) {
+            uint64_t bits = masks.admissible[w];
+            while (bits) {
+                int i = w * 64 + __builtin_ctzll(bits);
+                bits &= bits - 1;
+
+                const auto& e = neighbors[i];
                 if (visited[e.to] != visitedToken) {
                     visited[e.to] = visitedToken;
-                    parent[e.to] = {u, static_cast<int>(i)};
-                    st.push(e.to);
+                    parent[e.to] = {u, i};
+                    stack[top++] = e.to;
                     ++visited_nodes;
                     if (e.to == t) {
                         found = true;
+                        stop = i;
+                        break;
                     }
                 }
             }
         }
+
+        // Count the admissible arcs inspected (up to t when it was found)
+        if (found) {
+            visited_arcs_residual += ArcMasks::count_upto(masks.admissible, stop);
+            for (int w = 0; w <= (stop >> 6); ++w) masks.forward[w] &= masks.admissible[w];
+            visited_arcs_forward += ArcMasks::count_upto(masks.forward, stop);
+        } else {
+            visited_arcs_residual += masks.count_all(masks.admissible);
+            for (int w = 0; w * 64 < degree; ++w) masks.forward[w] &= masks.admissible[w];
+            visited_arcs_forward += masks.count_all(masks.forward);
+        }
     }
 
     stats->visited_nodes_per_iter.push_back(visited_nodes);
@@ -71,19 +117,20 @@ static bool dfs_with_delta(const Graph& graph, int s, int t, Path& path, int del
     return true;
 }
 
-bool capacity_scaling_path(const Graph& graph, int s, int t, Path& path, FFStats* stats) {
+template <typename Cap>
+bool capacity_scaling_path(const BasicGraph<Cap>& graph, int s, int t, Path& path, FFStats* stats) {
     // Initialize max capacity and delta only once
     if (!stats->max_cap_initialized) {
         stats->max_cap = 0;
         for (int u = 0; u < graph.size(); ++u) {
-            for (const Edge& e : graph.get_neighbors(u)) {
-                stats->max_cap = std::max(stats->max_cap, e.remaining_capacity());
+            for (const auto& e : graph.get_neighbors(u)) {
+                stats->max_cap = std::max<long long>(stats->max_cap, e.remaining_capacity());
             }
         }
         
         // Calculate initial delta as the highest power of 2 <= max_cap
         if (stats->max_cap > 0) {
-            stats->delta = 1 << (31 - __builtin_clz(stats->max_cap));
+            stats->delta = 1LL << (63 - __builtin_clzll(stats->max_cap));
         } else {
             stats->delta = 0;
         }
@@ -105,4 +152,7 @@ bool capacity_scaling_path(const Graph& graph, int s, int t, Path& path, FFStats
         stats->delta >>= 1;
     }
     return false;
-}
\ No newline at end of file
+}
+template bool capacity_scaling_path<int16_t>(const BasicGraph<int16_t>&, int, int, Path&, FFStats*);
+template bool capacity_scaling_path<int>(const BasicGraph<int>&, int, int, Path&, FFStats*);
+template bool capacity_scaling_path<long long>(const BasicGraph<long long>&, int, int, Path&, FFStats*);
@@ -1,20 +1,25 @@
 #include "find_path_headers/dfs_random.hpp"
 #include "find_path_headers/bfs.hpp"
+#include "arena.hpp"
 #include <vector>
 #include <algorithm>
+#include <numeric>
 #include <random>
-#include <stack>
 
-// Static RNG for better performance (avoids frequent re-seeding)
-static std::mt19937 rng(std::random_device{}());
+// Static RNG for better performance (avoids frequent re-seeding), one per thread
+static thread_local std::mt19937 rng(std::random_device{}());
 
 bool dfs_path(const Graph& graph, int source, int sink, Path& path, FFStats* stats) {
     const int n = graph.size();
     bfs_state::reset(n);
 
-    std::vector<std::pair<int, int>> parent(n, {-1, -1});
-    std::stack<int> s;
-    s.push(source);
+    // Parent links and an explicit stack (nodes are pushed once) from the scratch arena
+    Arena& scratch = scratch_arena();
+    scratch.release();
+    auto* parent = scratch.allocate_array<std::pair<int, int>>(n);
+    int* stack = scratch.allocate_array<int>(n);
+    int top = 0;
+    stack[top++] = source;
     bfs_state::visited[source] = bfs_state::visitedToken;
 
     // Pre-allocate order vector to avoid reallocations
@@ -26,9 +31,8 @@ bool dfs_path(const Graph& graph, int source, int sink, Path& path, FFStats* sta
     int visited_arcs_residual = 0;
     int visited_arcs_forward = 0;
 
-    while (!s.empty()) {
-        const int u = s.top();
-        s.pop();
+    while (top > 0) {
+        const int u = stack[--top];
     
         const auto& neighbors = graph.get_neighbors(u);
         const int degree = neighbors.size();
@@ -49,7 +53,7 @@ bool dfs_path(const Graph& graph, int source, int sink, Path& path, FFStats* sta
                 if (bfs_state::visited[e.to] != bfs_state::visitedToken) {
                     bfs_state::visited[e.to] = bfs_state::visitedToken;
                     parent[e.to] = {u, i};
-                    s.push(e.to);
+                    stack[top++] = e.to;
                     visited_nodes++;
 
                     if (e.to == sink) {
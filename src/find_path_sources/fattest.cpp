@@ -1,5 +1,6 @@
 #include "find_path_headers/fattest.hpp"
 #include "find_path_headers/bfs.hpp" // for bfs_state utilities
+#include "arena.hpp"
 #include <vector>
 #include <queue>
 #include <limits>
@@ -18,8 +19,11 @@ bool fattest_path(const Graph& graph, int s, int t, Path& path, FFStats* stats)
     int n = graph.size();
     bfs_state::reset(n);  // reset visited array using visitedToken trick
 
-    std::vector<int> max_cap(n, 0); // max bottleneck capacity to each node
-    std::vector<std::pair<int, int>> parent(n, {-1, -1}); // (prev_node, edge_index)
+    Arena& scratch = scratch_arena();
+    scratch.release();
+    int* max_cap = scratch.allocate_array<int>(n); // max bottleneck capacity to each node
+    std::fill(max_cap, max_cap + n, 0);
+    auto* parent = scratch.allocate_array<std::pair<int, int>>(n); // (prev_node, edge_index)
 
     int real_inserts = 0;
     int total_inserts = 0;
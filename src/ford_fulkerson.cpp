@@ -1,19 +1,47 @@
 #include "ford_fulkerson.hpp"
+#include "trace_writer.hpp"
 #include <algorithm>
 #include <climits>
 #include <cmath>
 #include <limits>
 #include <chrono>
+#include <vector>
+#include <queue>
 
 // forward declarations of helpers
-void computeCriticalStats(const Graph& graph, FFStats* stats);
-void populateStats(FFStats* stats,const Graph& graph,int s,int iterations,AlgorithmType type);
-
+template <typename Cap>
+void computeCriticalStats(const BasicGraph<Cap>& graph, FFStats* stats);
+template <typename Cap>
+void populateStats(FFStats* stats,const BasicGraph<Cap>& graph,int s,int iterations,AlgorithmType type);
+
+
+void FFStats::clear() {
+    // Every scalar back to its default; the emptied vectors keep their buffers
+    FFStats fresh;
+    auto recycle = [](auto& from, auto& into) {
+        from.clear();
+        into.swap(from);
+    };
+    recycle(criticalCount, fresh.criticalCount);
+    recycle(visited_nodes_per_iter, fresh.visited_nodes_per_iter);
+    recycle(visited_forward_arcs_per_iter, fresh.visited_forward_arcs_per_iter);
+    recycle(visited_residual_arcs_per_iter, fresh.visited_residual_arcs_per_iter);
+    recycle(heap_real_inserts_per_iter, fresh.heap_real_inserts_per_iter);
+    recycle(heap_implicit_updates_per_iter, fresh.heap_implicit_updates_per_iter);
+    recycle(heap_total_inserts_per_iter, fresh.heap_total_inserts_per_iter);
+    recycle(heap_deleteMins_per_iter, fresh.heap_deleteMins_per_iter);
+    recycle(pushes_per_thread, fresh.pushes_per_thread);
+    recycle(relabels_per_thread, fresh.relabels_per_thread);
+    fresh.trace = trace;
+    *this = std::move(fresh);
+}
 
 // Augments the flow along a valid s-t path.
 // Returns how much flow was added (bottleneck capacity).
-int augment(Graph& graph, const Path& path, FFStats* stats) {
-    int bottleneck = INT_MAX;
+template <typename Cap>
+Cap augment(BasicGraph<Cap>& graph, const Path& path, FFStats* stats) {
+    using Edge = BasicEdge<Cap>;
+    Cap bottleneck = std::numeric_limits<Cap>::max();
     auto& adj = graph.get_adj(); // Reference to adjacency list for flow updates
 
     // Find the bottleneck: minimum residual capacity in the path
@@ -41,12 +69,9 @@ int augment(Graph& graph, const Path& path, FFStats* stats) {
     return bottleneck;
 }
 
-// Repeatedly finds augmenting paths and applies flow until none remain
-int ford_fulkerson(Graph& graph, int s, int t, PathFindingStrategy find_path, AlgorithmType type, FFStats* stats) {
-    int max_flow = 0;
-    Path path;
-    int iterations = 0;
-
+// Sizes the per-arc counters before a run
+template <typename Cap>
+static void prepareStats(const BasicGraph<Cap>& graph, FFStats* stats) {
 	stats->n = graph.num_vertices();
     stats->m = graph.num_edges();
     stats->m_residual = graph.num_edges_residual();
@@ -54,16 +79,95 @@ int ford_fulkerson(Graph& graph, int s, int t, PathFindingStrategy find_path, Al
     // Resize the vector to contain a counter per arc, initialized to zero.
     stats->criticalCount.resize(stats->m_residual, 0);
     stats->offset = -graph.get_min_edge_id(); 
+}
+
+static const char* algorithmName(AlgorithmType type) {
+    switch (type) {
+        case AlgorithmType::DFS_RANDOM:            return "dfs_random";
+        case AlgorithmType::BFS_EDMONDS_KARP:      return "edmonds_karp";
+        case AlgorithmType::FATTEST_PATH:          return "fattest_path";
+        case AlgorithmType::CAPACITY_SCALING:      return "capacity_scaling";
+        case AlgorithmType::PARALLEL_PUSH_RELABEL: return "push_relabel";
+    }
+    return "";
+}
+
+// Sends the augmentation just applied to stats->trace; the search counters are the last
+// ones the path finder recorded
+static void traceAugmentation(const FFStats* stats, AlgorithmType type, int iteration, double start_us,
+                              const Path& path, long long bottleneck) {
+    TraceAugmentation event;
+    event.strategy = algorithmName(type);
+    event.iteration = iteration;
+    event.start_us = start_us;
+    event.end_us = stats->trace->now_us();
+    event.delta = type == AlgorithmType::CAPACITY_SCALING ? stats->delta : 0;
+    event.path_length = path.size();
+    event.bottleneck = bottleneck;
+    if (!stats->visited_nodes_per_iter.empty()) event.visited_nodes = stats->visited_nodes_per_iter.back();
+    if (!stats->visited_residual_arcs_per_iter.empty()) event.visited_arcs = stats->visited_residual_arcs_per_iter.back();
+    stats->trace->augmentation(event);
+}
+
+// Residual capacity of the cut around the set reachable from s through arcs with
+// residual >= delta. Returns -1 if t itself is reachable (no cut found).
+template <typename Cap>
+static long long residualCutCapacity(const BasicGraph<Cap>& graph, int s, int t, long long delta) {
+    std::vector<char> reached(graph.size(), 0);
+    std::queue<int> q;
+    q.push(s);
+    reached[s] = 1;
+
+    while (!q.empty()) {
+        int u = q.front();
+        q.pop();
+        for (const auto& e : graph.get_neighbors(u)) {
+            if (!reached[e.to] && e.remaining_capacity() >= delta) {
+                if (e.to == t) return -1;
+                reached[e.to] = 1;
+                q.push(e.to);
+            }
+        }
+    }
+
+    long long cut = 0;
+    for (int u = 0; u < graph.size(); ++u) {
+        if (!reached[u]) continue;
+        for (const auto& e : graph.get_neighbors(u)) {
+            if (!reached[e.to]) cut += e.remaining_capacity();
+        }
+    }
+    return cut;
+}
+
+// Repeatedly finds augmenting paths and applies flow until none remain
+template <typename Cap>
+FlowSum<Cap> ford_fulkerson(BasicGraph<Cap>& graph, int s, int t, BasicPathFindingStrategy<Cap> find_path,
+                            AlgorithmType type, FFStats* stats) {
+    FlowSum<Cap> max_flow = graph.net_out_flow(s); // Non-zero when the graph was warm-started
+    static thread_local Path path; // Keeps its buffer between runs
+    int iterations = 0;
+
+    prepareStats(graph, stats);
 
     // Start timer
     auto start = std::chrono::high_resolution_clock::now();
+    TraceWriter* trace = stats->trace;
+    const double trace_start = trace ? trace->now_us() : 0.0;
+    double search_start = trace_start;
 
     // Main loop: search-augment-repeat
     while (find_path(graph, s, t, path, stats)) {
         ++iterations;
-        max_flow += augment(graph, path, stats);
+        Cap pushed = augment(graph, path, stats);
+        max_flow += pushed;
+        if (trace) {
+            traceAugmentation(stats, type, iterations, search_start, path, pushed);
+            search_start = trace->now_us();
+        }
         //std::cerr << "Current max flow: " << max_flow << std::endl;
     }
+    if (trace) trace->run(algorithmName(type), trace_start, trace->now_us(), iterations, max_flow);
 
     if(type == AlgorithmType::BFS_EDMONDS_KARP){
         computeCriticalStats(graph, stats);
@@ -84,8 +188,76 @@ int ford_fulkerson(Graph& graph, int s, int t, PathFindingStrategy find_path, Al
 }
 
 
+template <typename Cap>
+bool ford_fulkerson_saturates(BasicGraph<Cap>& graph, int s, int t, BasicPathFindingStrategy<Cap> find_path,
+                              AlgorithmType type, FFStats* stats) {
+    const FlowSum<Cap> target = graph.total_out_capacity(s);
+    FlowSum<Cap> flow = graph.net_out_flow(s); // Non-zero when the graph was warm-started
+    static thread_local Path path; // Keeps its buffer between runs
+    int iterations = 0;
+    bool saturates = false;
+
+    prepareStats(graph, stats);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    TraceWriter* trace = stats->trace;
+    const double trace_start = trace ? trace->now_us() : 0.0;
+    double search_start = trace_start;
+
+    // Sink-side cut: everything that can still enter t
+    long long sink_cut = 0;
+    for (const auto& e : graph.get_neighbors(t)) {
+        const auto& into_t = graph.get_neighbors(e.to)[e.rev];
+        sink_cut += into_t.remaining_capacity();
+    }
+
+    if (flow == target) {
+        saturates = true;
+    } else if (flow + sink_cut >= target) {
+        long long phase_delta = 0; // Delta of the capacity scaling phase currently running
+
+        while (find_path(graph, s, t, path, stats)) {
+            // A scaling phase stalled inside find_path: the set reachable with residual >= 2*delta
+            // (the last phase that failed) defines a cut whose capacity bounds the max flow.
+            if (type == AlgorithmType::CAPACITY_SCALING && phase_delta != 0 && stats->delta < phase_delta) {
+                long long cut = residualCutCapacity(graph, s, t, 2 * stats->delta);
+                if (cut >= 0 && flow + cut < target) break;
+            }
+            phase_delta = stats->delta;
+
+            ++iterations;
+            Cap pushed = augment(graph, path, stats);
+            flow += pushed;
+            if (trace) {
+                traceAugmentation(stats, type, iterations, search_start, path, pushed);
+                search_start = trace->now_us();
+            }
+            if (flow == target) {
+                saturates = true;
+                break;
+            }
+        }
+    }
+
+    if (trace) trace->run(algorithmName(type), trace_start, trace->now_us(), iterations, flow);
+
+    if(type == AlgorithmType::BFS_EDMONDS_KARP){
+        computeCriticalStats(graph, stats);
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> elapsed = end - start;
+    stats->total_runtime = elapsed.count();
+
+    populateStats(stats, graph, s, iterations, type);
+
+    return saturates;
+}
+
+
 // Helper function to compute critical edge statistics (C_frac and r_bar)
-void computeCriticalStats(const Graph& graph, FFStats* stats) {
+template <typename Cap>
+void computeCriticalStats(const BasicGraph<Cap>& graph, FFStats* stats) {
     int n = graph.size();
     double half_n = n / 2.0;
     int m = stats->criticalCount.size();
@@ -103,13 +275,14 @@ void computeCriticalStats(const Graph& graph, FFStats* stats) {
 }
 
 // Helper function to populate algorithm-specific stats
-void populateStats(FFStats* stats, const Graph& graph, int s, int iterations, AlgorithmType type) {
+template <typename Cap>
+void populateStats(FFStats* stats, const BasicGraph<Cap>& graph, int s, int iterations, AlgorithmType type) {
 
     stats->iterations = iterations;
     stats->n = graph.size();
     stats->m = graph.num_edges();
     stats->m_residual= graph.num_edges_residual();       
-    int C = graph.total_out_capacity(s); 
+    double C = static_cast<double>(graph.total_out_capacity(s));
 
     // ----------------------
     // Compute theoretical upper bound on number of iterations
@@ -123,10 +296,13 @@ void populateStats(FFStats* stats, const Graph& graph, int s, int iterations, Al
             stats->bound = static_cast<double>(stats->n) * stats->m_residual / 2.0;
             break;
         case AlgorithmType::FATTEST_PATH:
-            stats->bound = stats->m_residual * std::log2(std::max(1, C));
+            stats->bound = stats->m_residual * std::log2(std::max(1.0, C));
             break;
         case AlgorithmType::CAPACITY_SCALING:
-            stats->bound = stats->m_residual * std::log2(std::max(1, C));
+            stats->bound = stats->m_residual * std::log2(std::max(1.0, C));
+            break;
+        case AlgorithmType::PARALLEL_PUSH_RELABEL:
+            stats->bound = static_cast<double>(stats->n) * stats->n * stats->m_residual;
             break;
     }
 
@@ -208,4 +384,13 @@ void populateStats(FFStats* stats, const Graph& graph, int s, int iterations, Al
     stats->time_over_I_sntm = (I > 0 && stats->n > 0 && stats->m_residual > 0)
         ? T / (I * (stats->s_bar * stats->n + stats->t_bar_residual * stats->m_residual)) : 0.0;
 
-}
\ No newline at end of file
+}
+#define INSTANTIATE_FORD_FULKERSON(Cap)                                                              \
+    template FlowSum<Cap> ford_fulkerson<Cap>(BasicGraph<Cap>&, int, int, BasicPathFindingStrategy<Cap>, \
+                                              AlgorithmType, FFStats*);                             \
+    template bool ford_fulkerson_saturates<Cap>(BasicGraph<Cap>&, int, int, BasicPathFindingStrategy<Cap>, \
+                                                 AlgorithmType, FFStats*);
+
+INSTANTIATE_FORD_FULKERSON(int16_t)
+INSTANTIATE_FORD_FULKERSON(int)
+INSTANTIATE_FORD_FULKERSON(long long)
@@ -0,0 +1,152 @@
+#include "generator.hpp"
+#include "thread_pool.hpp"
+#include "tournament.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+    // start, start + step, ... up to end (inclusive, tolerant to rounding in the step)
+    std::vector<double> grid(double start, double end, double step) {
+        std::vector<double> values;
+        int count = step > 0 ? static_cast<int>(std::floor((end - start) / step + 1e-9)) + 1 : 1;
+        for (int k = 0; k < count; ++k) values.push_back(start + k * step);
+        return values;
+    }
+
+    // Same folder names as bash/create_dataset2.sh: alpha_0_5__bias_+0_1
+    std::string cell_name(double alpha, double bias) {
+        char buffer[64];
+        std::snprintf(buffer, sizeof(buffer), "alpha_%03.1f__bias_%+04.1f", alpha, bias);
+        std::string name = buffer;
+        for (char& ch : name) {
+            if (ch == '.') ch = '_';
+        }
+        return name;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    GeneratorParams params;
+    params.teams = 100;
+    params.rounds = 10;
+    int instances = 100;
+    double alpha_start = 0.0, alpha_end = 1.0, alpha_step = 0.1;
+    double bias_start = -1.0, bias_end = 1.0, bias_step = 0.1;
+    int threads = 0; // 0 = todas as threads do hardware
+    std::uint64_t seed = std::random_device{}();
+    bool binary = false;
+    bool sparse = false;
+    std::string out_dir = "dataset2";
+
+    for (int a = 1; a < argc; ++a) {
+        std::string arg = argv[a];
+        if (arg == "--teams" && a + 1 < argc) {
+            params.teams = std::stoi(argv[++a]);
+        } else if (arg == "--rounds" && a + 1 < argc) {
+            params.rounds = std::stoi(argv[++a]);
+        } else if (arg == "--instances" && a + 1 < argc) {
+            instances = std::stoi(argv[++a]);
+        } else if (arg == "--alpha" && a + 3 < argc) {
+            alpha_start = std::stod(argv[++a]);
+            alpha_end = std::stod(argv[++a]);
+            alpha_step = std::stod(argv[++a]);
+        } else if (arg == "--bias" && a + 3 < argc) {
+            bias_start = std::stod(argv[++a]);
+            bias_end = std::stod(argv[++a]);
+            bias_step = std::stod(argv[++a]);
+        } else if (arg == "--threads" && a + 1 < argc) {
+            threads = std::stoi(argv[++a]);
+        } else if (arg == "--seed" && a + 1 < argc) {
+            seed = std::stoull(argv[++a]);
+        } else if (arg == "--binary") {
+            binary = true;
+        } else if (arg == "--sparse") {
+            sparse = true;
+        } else if (arg == "--out" && a + 1 < argc) {
+            out_dir = argv[++a];
+        } else {
+            std::cerr << "Uso: " << argv[0] << " [--teams N] [--rounds C] [--instances K]"
+                      << " [--alpha início fim passo] [--bias início fim passo]"
+                      << " [--threads T] [--seed S] [--binary | --sparse] [--out pasta]\n";
+            return 1;
+        }
+    }
+
+    if (params.teams < 2 || params.rounds <= 0 || instances <= 0 ||
+        alpha_start < 0.0 || alpha_end > 1.0 || bias_start < -1.0 || bias_end > 1.0) {
+        std::cerr << "Parâmetros inválidos: n >= 2, c > 0, K > 0, 0 <= alpha <= 1 e -1 <= bias <= 1.\n";
+        return 1;
+    }
+
+    // Uma célula por par (alpha, bias); cada thread gera as células tid, tid + T, ...
+    // com seu próprio gerador, então a mesma semente e o mesmo T reproduzem o dataset
+    struct Cell {
+        double alpha;
+        double bias;
+    };
+    std::vector<Cell> cells;
+    for (double alpha : grid(alpha_start, alpha_end, alpha_step))
+        for (double bias : grid(bias_start, bias_end, bias_step))
+            cells.push_back({alpha, bias});
+
+    auto start = std::chrono::high_resolution_clock::now();
+    ThreadPool pool(threads > 0 ? threads : ThreadPool::default_threads());
+    std::atomic<int> failures{0};
+
+    pool.run([&](int tid) {
+        TournamentGenerator generator(seed, tid);
+        GeneratorParams cell_params = params;
+        Tournament tournament;
+
+        for (size_t c = tid; c < cells.size(); c += pool.size()) {
+            cell_params.alpha = cells[c].alpha;
+            cell_params.bias = cells[c].bias;
+            fs::path dir = fs::path(out_dir) / cell_name(cells[c].alpha, cells[c].bias);
+            std::error_code ec;
+            fs::create_directories(dir, ec);
+
+            if (binary) {
+                std::ofstream out(dir / "instances.bin", std::ios::binary);
+                for (int k = 0; k < instances; ++k) {
+                    generator.generate(cell_params, tournament);
+                    write_tournament_binary(out, tournament);
+                }
+                if (!out) ++failures;
+            } else {
+                for (int k = 1; k <= instances; ++k) {
+                    generator.generate(cell_params, tournament);
+                    std::ofstream out(dir / ("instance_" + std::to_string(k) + ".txt"));
+                    if (sparse) {
+                        write_tournament_sparse(out, tournament);
+                    } else {
+                        write_tournament(out, tournament);
+                    }
+                    if (!out) ++failures;
+                }
+            }
+        }
+    });
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = end - start;
+
+    if (failures > 0) {
+        std::cerr << "erro: " << failures << " arquivo(s) não puderam ser escritos em " << out_dir << "\n";
+        return 1;
+    }
+
+    std::cout << cells.size() * instances << " instâncias em " << cells.size() << " pastas de "
+              << out_dir << " (" << elapsed.count() << " s, semente " << seed << ")\n";
+    return 0;
+}
@@ -0,0 +1,54 @@
+#include "generator.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+std::mt19937_64 seeded_rng(std::uint64_t seed, int stream) {
+    std::seed_seq seq{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32),
+                      static_cast<std::uint32_t>(stream)};
+    return std::mt19937_64(seq);
+}
+
+TournamentGenerator::TournamentGenerator(std::uint64_t seed, int stream) : rng(seeded_rng(seed, stream)) {}
+
+void TournamentGenerator::generate(const GeneratorParams& params, Tournament& out) {
+    const int n = params.teams;
+    const int c = params.rounds;
+    const int pairs = n * (n - 1) / 2;
+    const int total = c * pairs;
+    const int samples = std::min(total, static_cast<int>(std::ceil(params.alpha * total)));
+
+    // 1. Which games were played: each one by a pair drawn uniformly among those with games
+    //    left, as gen_tournament does; a pair leaves `live` once it has played all c games
+    live.resize(pairs);
+    std::iota(live.begin(), live.end(), 0);
+    played.assign(pairs, 0);
+    int live_count = pairs;
+    for (int k = 0; k < samples; ++k) {
+        const int index = bounded_random(rng, live_count);
+        const int pair = live[index];
+        if (++played[pair] == c) std::swap(live[index], live[--live_count]);
+    }
+
+    // 2. Who won them, and what is left to play
+    out.n = n;
+    out.w.assign(n, 0);
+    out.fixtures.clear();
+
+    int pair = 0;
+    for (int i = 0; i < n; ++i) {
+        for (int j = i + 1; j < n; ++j, ++pair) {
+            const int games = played[pair];
+            if (games > 0) {
+                double p = std::clamp(unit_random(rng) + (i == 0 ? params.bias : 0.0), 0.0, 1.0);
+                int wins_i = 0;
+                for (int g = 0; g < games; ++g) {
+                    if (unit_random(rng) < p) ++wins_i;
+                }
+                out.w[i] += wins_i;
+                out.w[j] += games - wins_i;
+            }
+            if (c - games > 0) out.fixtures.push_back({i, j, c - games});
+        }
+    }
+}
@@ -1,5 +1,7 @@
 // graph.cpp
 #include "graph.hpp"
+#include "tournament.hpp"
+#include "presolve.hpp"
 #include <sstream>
 #include <stdexcept>
 #include <iostream> //debug for residual graph
@@ -10,58 +12,88 @@
 #include <vector>
 #include <limits>
 #include <algorithm>  // std::max
+#include <type_traits>
 #include <iostream>   // std::istream
 
 
+namespace {
+    // Whether a network with Cap arcs holds an arc of this capacity with room for its
+    // "infinite" arcs (max / 2) above it, and a total this large out of the source (see
+    // choose_capacity_width). long long, the widest type, takes anything
+    template <typename Cap>
+    bool fits_capacity(long long capacity) {
+        return std::is_same_v<Cap, long long> || capacity < std::numeric_limits<Cap>::max() / 2;
+    }
+
+    template <typename Cap>
+    bool fits_total(long long total) {
+        return std::is_same_v<Cap, long long> || total <= std::numeric_limits<FlowSum<Cap>>::max();
+    }
+}
+
 // Constructor that initializes the graph with n nodes
-Graph::Graph(int n) : n(n), adj_list(n) {}
+template <typename Cap>
+BasicGraph<Cap>::BasicGraph(int n, Arena* arena)
+    : n(n), arena(arena), adj_list(n, EdgeListType(ArenaAllocator<EdgeType>(arena)), ArenaAllocator<EdgeListType>(arena)) {}
+
+template <typename Cap>
+void BasicGraph<Cap>::reset_adjacency() {
+    adj_list.assign(n, EdgeListType(ArenaAllocator<EdgeType>(arena)));
+    original_ids.clear();
+}
 
 // Adds a forward and reverse edge (for residual graph) between 'from' and 'to'
-void Graph::add_edge(int from, int to, int capacity) {
+template <typename Cap>
+void BasicGraph<Cap>::add_edge(int from, int to, Cap capacity) {
     int fid = next_edge_id++;   // ID for forward edge
     int rid = next_edge_id_reverse--;
     // Forward edge: from → to with given capacity
-    Edge forward = {fid, to, from, static_cast<int>(adj_list[to].size()), capacity, 0};
+    EdgeType forward = {fid, to, from, static_cast<int>(adj_list[to].size()), capacity, 0};
     // Reverse edge: to → from with 0 capacity (initially) and fid = -1 to sinalize it is a backward edge, used for flow cancellation
-    Edge backward = {rid, from, to, static_cast<int>(adj_list[from].size()), 0, 0};
+    EdgeType backward = {rid, from, to, static_cast<int>(adj_list[from].size()), 0, 0};
 
     adj_list[from].push_back(forward);
     adj_list[to].push_back(backward);
 }
 
-int Graph::size() const {
+template <typename Cap>
+int BasicGraph<Cap>::size() const {
     return n;
 }
 
-int Graph::num_vertices() const {
+template <typename Cap>
+int BasicGraph<Cap>::num_vertices() const {
     return size();
 }
 
 // Count only edges with positive capacity (original forward edges)
-int Graph::num_edges() const {
+template <typename Cap>
+int BasicGraph<Cap>::num_edges() const {
     int count = 0;
     for (const auto& vec : adj_list) {
-        for (const Edge& e : vec) {
+        for (const EdgeType& e : vec) {
             if (e.capacity > 0) ++count;
         }
     }
     return count;
 }
 
-int Graph::num_edges_residual() const {
+template <typename Cap>
+int BasicGraph<Cap>::num_edges_residual() const {
     int count = 0;
     for (const auto& neighbors : adj_list) {
-        for ([[maybe_unused]]const Edge& e : neighbors) {
+        for ([[maybe_unused]]const EdgeType& e : neighbors) {
             count++;
         }
     }
     return count;
 }
 
-int Graph::get_min_edge_id() const {
+template <typename Cap>
+int BasicGraph<Cap>::get_min_edge_id() const {
     int min_id = std::numeric_limits<int>::max();
     for (const auto& neighbors : adj_list) {
-        for (const Edge& e : neighbors) {
+        for (const EdgeType& e : neighbors) {
             min_id = std::min(min_id, e.id);
         }
     }
@@ -69,43 +101,119 @@ int Graph::get_min_edge_id() const {
 }
 
 // Sum of capacities of all outgoing edges from node s
-int Graph::total_out_capacity(int s) const {
-    int sum = 0;
-    for ( const Edge& e : adj_list[s]) {
+template <typename Cap>
+FlowSum<Cap> BasicGraph<Cap>::total_out_capacity(int s) const {
+    FlowSum<Cap> sum = 0;
+    for ( const EdgeType& e : adj_list[s]) {
         sum += e.capacity;
     }
     return sum;
 }
 
+// Net flow leaving node s (reverse edges carry negative flow, so they cancel out)
+template <typename Cap>
+FlowSum<Cap> BasicGraph<Cap>::net_out_flow(int s) const {
+    FlowSum<Cap> sum = 0;
+    for (const EdgeType& e : adj_list[s]) {
+        sum += e.flow;
+    }
+    return sum;
+}
+
 // Returns the adjacency list of a given node
-const std::vector<Edge>& Graph::adj(int u) const {
+template <typename Cap>
+const typename BasicGraph<Cap>::EdgeListType& BasicGraph<Cap>::adj(int u) const {
     return adj_list[u];
 }
 
 // Returns the list of edges from node u (same as adj)
-const std::vector<Edge>& Graph::get_neighbors(int u) const {
+template <typename Cap>
+const typename BasicGraph<Cap>::EdgeListType& BasicGraph<Cap>::get_neighbors(int u) const {
     return adj_list[u];
 }
 
 // Returns the full adjacency list for modifying flows
-std::vector<std::vector<Edge>>& Graph::get_adj() {
+template <typename Cap>
+typename BasicGraph<Cap>::AdjacencyListType& BasicGraph<Cap>::get_adj() {
     return adj_list;
 }
 
-int Graph::get_source() const {
+template <typename Cap>
+int BasicGraph<Cap>::get_source() const {
     return source;
 }
 
-int Graph::get_sink() const {
+template <typename Cap>
+int BasicGraph<Cap>::get_sink() const {
     return sink;
 }
 
-bool Graph::get_cant_be_champion() const {
+template <typename Cap>
+bool BasicGraph<Cap>::get_cant_be_champion() const {
     return cant_be_champion;
 }
 
+template <typename Cap>
+int BasicGraph<Cap>::original_id(int u) const {
+    return original_ids.empty() ? u : original_ids[u];
+}
+
+// Moves node u to position new_id[u]. Each node's arcs are sorted by their new target
+// so scans walk memory in order; rev indices and source/sink are remapped accordingly.
+template <typename Cap>
+void BasicGraph<Cap>::permute_nodes(const std::vector<int>& new_id) {
+    // arc_pos[u][i] = new index of adj_list[u][i] inside its (sorted) list
+    std::vector<std::vector<int>> arc_pos(n);
+    std::vector<int> order;
+    for (int u = 0; u < n; ++u) {
+        const auto& arcs = adj_list[u];
+        order.resize(arcs.size());
+        for (size_t i = 0; i < arcs.size(); ++i) order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+            return new_id[arcs[a].to] < new_id[arcs[b].to];
+        });
+        arc_pos[u].resize(arcs.size());
+        for (size_t k = 0; k < order.size(); ++k) arc_pos[u][order[k]] = k;
+    }
+
+    AdjacencyListType new_adj(n, EdgeListType(ArenaAllocator<EdgeType>(arena)), ArenaAllocator<EdgeListType>(arena));
+    for (int u = 0; u < n; ++u) {
+        auto& arcs = new_adj[new_id[u]];
+        arcs.resize(adj_list[u].size());
+        for (size_t i = 0; i < adj_list[u].size(); ++i) {
+            EdgeType e = adj_list[u][i];
+            e.rev = arc_pos[e.to][e.rev];
+            e.to = new_id[e.to];
+            e.from = new_id[e.from];
+            arcs[arc_pos[u][i]] = e;
+        }
+    }
+    adj_list = std::move(new_adj);
+
+    std::vector<int> ids(n);
+    for (int u = 0; u < n; ++u) ids[new_id[u]] = original_id(u);
+    original_ids = std::move(ids);
+
+    if (source != -1) source = new_id[source];
+    if (sink != -1) sink = new_id[sink];
+}
+
+template <typename Cap>
+void BasicGraph<Cap>::set_terminals(int s, int t) {
+    source = s;
+    sink = t;
+}
+
+template <typename Cap>
+void BasicGraph<Cap>::reset_flow() {
+    for (auto& arcs : adj_list) {
+        for (EdgeType& e : arcs) e.flow = 0;
+    }
+}
+
 // Reads a graph in DIMACS max-flow format from an input stream
-void Graph::read_dimacs(std::istream& in) {
+template <typename Cap>
+void BasicGraph<Cap>::read_dimacs(std::istream& in) {
     std::string line;
     while (std::getline(in, line)) {
         if (line.empty() || line[0] == 'c') continue; // Skip comments
@@ -122,7 +230,7 @@ void Graph::read_dimacs(std::istream& in) {
                 throw std::runtime_error("Only 'max' problems are supported");
             }
             n = nodes;
-            adj_list.assign(n, {});
+            reset_adjacency();
         } else if (type == 'n') {
             int id;
             char role;
@@ -130,9 +238,13 @@ void Graph::read_dimacs(std::istream& in) {
             if (role == 's') source = id - 1;
             if (role == 't') sink = id - 1;
         } else if (type == 'a') {
-            int from, to, cap;
+            int from, to;
+            long long cap;
             iss >> from >> to >> cap;
-            add_edge(from - 1, to - 1, cap);
+            if (!fits_capacity<Cap>(cap)) {
+                throw std::overflow_error("DIMACS capacity does not fit the arc type");
+            }
+            add_edge(from - 1, to - 1, static_cast<Cap>(cap));
             //std::cout << "Adding edge: " << from - 1 << " -> " << to - 1 << " with capacity " << cap << std::endl;
 
         }
@@ -146,91 +258,148 @@ void Graph::read_dimacs(std::istream& in) {
 
     compress_graph();
 
+    long long total = 0;
+    for (const EdgeType& e : adj_list[source]) total += e.capacity;
+    if (!fits_total<Cap>(total)) {
+        throw std::overflow_error("DIMACS source capacity does not fit the flow type");
+    }
+
     // Imprime o grafo residual no terminal
     // print_residual_graph();
 }
 
-void Graph::fromTournament(std::istream& in) {
-    int n;
-    in >> n;
-    assert(n > 1);
-
-    // current wins for each team
-    std::vector<int> w(n);
-    for (int i = 0; i < n; ++i) in >> w[i];
-
-    // remaining games matrix (upper triangular)
-    std::vector<std::vector<int>> g(n, std::vector<int>(n, 0));
-    for (int i = 0; i < n; ++i)
-        for (int j = i + 1; j < n; ++j) {
-            in >> g[i][j];
-            g[j][i] = g[i][j];
-        }
+template <typename Cap>
+void BasicGraph<Cap>::fromTournament(std::istream& in) {
+    fromTournament(read_tournament(in));
+}
 
-    // compute total games remaining for team 1 and its max possible wins
-    int r1 = 0;
-    for (int j = 1; j < n; ++j)
-        r1 += g[0][j];
-    int maxW1 = w[0] + r1;
+template <typename Cap>
+void BasicGraph<Cap>::fromTournament(const Tournament& t) {
+    int n = t.n;
 
-    // compute allowed additional wins for other teams (clamped at 0)
-    std::vector<int> m(n);
+    // count the remaining games between teams 2..n (team 1's games are assumed won)
+    int Gm = 0;
+    for (const Fixture& f : t.fixtures)
+        if (f.i > 0)
+            ++Gm;
+
+    // vertices: 0 = source, 1..Gm = game nodes, Gm+1..Gm+n-1 = teams 2..n, last = sink
+    this->n = 1 + Gm + (n - 1) + 1;
+    this->reset_adjacency();
+    this->source = 0;
+    this->sink   = this->n - 1;
+
+    const Cap INF = std::numeric_limits<Cap>::max() / 2;
+    int gameStart = 1;
+    int teamStart = gameStart + Gm;
+
+    // edges: source → each game node (capacity = number of games)
+    int idx = 0;
+    for (const Fixture& f : t.fixtures) {
+        if (f.i == 0) continue;
+        this->add_edge(source, gameStart + idx++, f.games);
+    }
+
+    // edges: game node → both participating teams (infinite capacity)
+    idx = 0;
+    for (const Fixture& f : t.fixtures) {
+        if (f.i == 0) continue;
+        this->add_edge(gameStart + idx, teamStart + (f.i - 1), INF);
+        this->add_edge(gameStart + idx, teamStart + (f.j - 1), INF);
+        ++idx;
+    }
+
+    // edges: each team → sink (capacity = allowed wins, clamped at 0)
+    const int maxW1 = t.max_wins_team1();
     for (int i = 1; i < n; ++i) {
-        m[i] = maxW1 - w[i] - 1;
-        if (m[i] < 0){
+        int m = maxW1 - t.w[i] - 1;
+        if (m < 0) {
             this->cant_be_champion = true;
-            m[i] = 0;
+            m = 0;
         }
+        this->add_edge(teamStart + (i - 1), sink, m);
     }
+}
 
-    // collect all remaining games between teams 2..n
-    struct P { int i, j; };
-    std::vector<P> games;
-    int totalGames = 0;
-    for (int i = 1; i < n; ++i)
-        for (int j = i + 1; j < n; ++j)
-            if (g[i][j] > 0) {
-                games.push_back({i, j});
-                totalGames += g[i][j];
-            }
+// Same layout as fromTournament, but team 1's games are also game nodes and team 1
+// gets a sink arc of capacity k. Every other team i may win at most w[0] + k - w[i] - 1
+// more games, so all sink capacities grow by one when k grows by one.
+// Saturating the source means team 1 can finish strictly first winning exactly k games.
+template <typename Cap>
+void BasicGraph<Cap>::fromTournamentParametric(const Tournament& t, int k) {
+    int n = t.n;
+
+    int Gm = t.fixtures.size();
+    // vertices: 0 = source, 1..Gm = game nodes, Gm+1..Gm+n = teams 1..n, last = sink
+    this->n = 1 + Gm + n + 1;
+    this->reset_adjacency();
+    this->source = 0;
+    this->sink   = this->n - 1;
+    this->cant_be_champion = false;
 
-    int Gm = games.size();
-    // vertices: 0 = source, 1..Gm = game nodes, Gm+1..Gm+n-1 = teams 2..n, last = sink
-    this->n = 1 + Gm + (n - 1) + 1;
-    this->adj_list.assign(this->n, {});
+    const Cap INF = std::numeric_limits<Cap>::max() / 2;
+    int gameStart = 1;
+    int teamStart = gameStart + Gm;
+
+    for (int idx = 0; idx < Gm; ++idx) {
+        this->add_edge(source, gameStart + idx, t.fixtures[idx].games);
+    }
+
+    for (int idx = 0; idx < Gm; ++idx) {
+        this->add_edge(gameStart + idx, teamStart + t.fixtures[idx].i, INF);
+        this->add_edge(gameStart + idx, teamStart + t.fixtures[idx].j, INF);
+    }
+
+    this->add_edge(teamStart, sink, k);
+    for (int i = 1; i < n; ++i) {
+        int cap = t.w[0] + k - t.w[i] - 1;
+        if (cap < 0) {
+            this->cant_be_champion = true;
+            cap = 0;
+        }
+        this->add_edge(teamStart + i, sink, cap);
+    }
+}
+
+// Same layout as fromTournament over the nodes of a presolved network.
+// Games inside a merged node get a single arc to that node.
+template <typename Cap>
+void BasicGraph<Cap>::fromReduced(const ReducedNetwork& net) {
+    int teams = net.slack.size();
+    int Gm = net.fixtures.size();
+    // vertices: 0 = source, 1..Gm = game nodes, then one node per reduced team, last = sink
+    this->n = 1 + Gm + teams + 1;
+    this->reset_adjacency();
     this->source = 0;
     this->sink   = this->n - 1;
+    this->cant_be_champion = net.cant_be_champion;
 
-    const int INF = std::numeric_limits<int>::max() / 2;
+    const Cap INF = std::numeric_limits<Cap>::max() / 2;
     int gameStart = 1;
     int teamStart = gameStart + Gm;
 
-    // edges: source → each game node (capacity = number of games)
     for (int idx = 0; idx < Gm; ++idx) {
-        int i = games[idx].i;
-        int j = games[idx].j;
-        this->add_edge(source, gameStart + idx, g[i][j]);
+        this->add_edge(source, gameStart + idx, net.fixtures[idx].games);
     }
 
-    // edges: game node → both participating teams (infinite capacity)
     for (int idx = 0; idx < Gm; ++idx) {
-        int i = games[idx].i;
-        int j = games[idx].j;
-        this->add_edge(gameStart + idx, teamStart + (i - 1), INF);
-        this->add_edge(gameStart + idx, teamStart + (j - 1), INF);
+        const Fixture& f = net.fixtures[idx];
+        this->add_edge(gameStart + idx, teamStart + f.i, INF);
+        if (f.j != f.i) this->add_edge(gameStart + idx, teamStart + f.j, INF);
     }
 
-    // edges: each team → sink (capacity = allowed wins)
-    for (int i = 1; i < n; ++i)
-        this->add_edge(teamStart + (i - 1), sink, m[i]);
+    for (int v = 0; v < teams; ++v)
+        this->add_edge(teamStart + v, sink, net.slack[v]);
 }
 
-void Graph::compress_graph() {
+template <typename Cap>
+void BasicGraph<Cap>::compress_graph() {
     // Mapa para armazenar capacidades de ida e volta entre pares (u, v)
-    std::map<std::pair<int, int>, int> forward_capacity;
+    // (somadas em long long: arcos paralelos podem passar do limite de Cap)
+    std::map<std::pair<int, int>, long long> forward_capacity;
 
     for (int u = 0; u < n; ++u) {
-        for (const Edge& e : adj_list[u]) {
+        for (const EdgeType& e : adj_list[u]) {
             if (e.capacity > 0) {
                 forward_capacity[{u, e.to}] += e.capacity;
             }
@@ -238,7 +407,7 @@ void Graph::compress_graph() {
     }
 
     // Nova lista de adjacência consolidada
-    std::vector<std::vector<Edge>> new_adj(n);
+    AdjacencyListType new_adj(n, EdgeListType(ArenaAllocator<EdgeType>(arena)), ArenaAllocator<EdgeListType>(arena));
     std::set<std::pair<int, int>> handled;
 
     for (const auto& [pair, cap_uv] : forward_capacity) {
@@ -249,18 +418,21 @@ void Graph::compress_graph() {
         handled.insert({u, v});
         handled.insert({v, u});
 
-        int cap_uv_final = forward_capacity[{u, v}];
-        int cap_vu_final = forward_capacity[{v, u}];
+        if (!fits_capacity<Cap>(cap_uv) || !fits_capacity<Cap>(forward_capacity[{v, u}])) {
+            throw std::overflow_error("Merged capacity does not fit the arc type");
+        }
+        Cap cap_uv_final = static_cast<Cap>(cap_uv);
+        Cap cap_vu_final = static_cast<Cap>(forward_capacity[{v, u}]);
 
         // Criação de uma nova aresta forward (u → v)
         int fid = next_edge_id_aux++; // Cria um novo fid
 
         // u → v (forward)
-        Edge forward = {fid, v, u, static_cast<int>(new_adj[v].size()), cap_uv_final, 0};
+        EdgeType forward = {fid, v, u, static_cast<int>(new_adj[v].size()), cap_uv_final, 0};
         new_adj[u].push_back(forward);
 
         // v → u (reverse)
-        Edge backward = {-1, u, v, static_cast<int>(new_adj[u].size()) - 1, cap_vu_final, 0};
+        EdgeType backward = {-1, u, v, static_cast<int>(new_adj[u].size()) - 1, cap_vu_final, 0};
         new_adj[v].push_back(backward);
     }
 
@@ -268,11 +440,12 @@ void Graph::compress_graph() {
 }
 
 // Imprime o grafo residual no terminal
-void Graph::print_residual_graph() const {
+template <typename Cap>
+void BasicGraph<Cap>::print_residual_graph() const {
     std::cout << "Residual Graph:\n";
 
     for (int u = 0; u < n; ++u) {
-        for (const Edge& e : adj_list[u]) {
+        for (const EdgeType& e : adj_list[u]) {
             // Mostra todas as arestas, inclusive reversas
             std::cout << "  " << u << " -> " << e.to
                       << " | cap: " << e.capacity
@@ -281,4 +454,7 @@ void Graph::print_residual_graph() const {
                       << "\n";
         }
     }
-}
\ No newline at end of file
+}
+template class BasicGraph<int16_t>;
+template class BasicGraph<int>;
+template class BasicGraph<long long>;
@@ -5,44 +5,365 @@
 #include "find_path_headers/dfs_random.hpp"
 #include "find_path_headers/fattest.hpp"
 #include "find_path_headers/capacity_scaling.hpp"
+#include "warm_start.hpp"
+#include "tournament.hpp"
+#include "prefilter.hpp"
+#include "parametric.hpp"
+#include "presolve.hpp"
+#include "components.hpp"
+#include "reorder.hpp"
+#include "stream_server.hpp"
+#include "simulation.hpp"
+#include "batch_solver.hpp"
+#include "scenario.hpp"
+#include "sensitivity.hpp"
+#include "certificate.hpp"
+#include "result_cache.hpp"
+#include "engine_model.hpp"
 
 
 #include <iostream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
-int main() {
+int main(int argc, char* argv[]) {
     std::ios::sync_with_stdio(false);
     std::cin.tie(nullptr);
 
-    // 1. Constrói o grafo a partir do torneio
-    Graph graph;
-    graph.fromTournament(std::cin);
+    bool min_wins_mode = false;
+    bool stream_mode = false;
+    bool binary_mode = false;
+    bool batch_mode = false;
+    bool what_if_mode = false;
+    bool critical_mode = false;
+    bool certificate_mode = false;
+    bool warm_start = false; // Fluxo guloso inicial antes do motor de decisão
+    std::string verify_list; // Vazio = sem verificação
+    std::string cache_dir;   // Vazio = sem cache
+    int threads = 0; // 0 = todas as threads do hardware
+    NodeOrder node_order = NodeOrder::NONE;
+    DecisionEngine engine = DecisionEngine::CAPACITY_SCALING;
+    std::string engine_model_path; // Vazio = coeficientes embutidos do motor auto (bin/bench_engines --out gera outros)
+    long long simulate_samples = 0; // 0 = sem simulação
+    double alpha = 0.5;
+    double bias = 0.0;
+    std::string model_name = "even";
+    unsigned long long seed = std::random_device{}();
+    bool solver_options = false;   // --threads, --order, --engine ou --engine-model na linha de comando
+    bool simulate_options = false; // --alpha, --bias, --model ou --seed na linha de comando
 
+    auto usage = [&]() {
+        std::cerr << "Uso: " << argv[0] << " [--min-wins | --critical | --certificate | --stream | --binary | --cache DIR] [--threads N] [--order none|bfs|rcm|team] [--engine capacity_scaling|edmonds_karp|dinic|auto [--engine-model ARQ]] [--warm-start] < torneio\n"
+                  << "     " << argv[0] << " --binary --batch < registros\n"
+                  << "     " << argv[0] << " --verify TIME,TIME,... < torneio\n"
+                  << "     " << argv[0] << " --what-if < torneio seguido de comandos\n"
+                  << "     " << argv[0] << " --simulate AMOSTRAS [--alpha A] [--bias B] [--model even|random] [--seed S] [--threads N] < torneio\n";
+        return 1;
+    };
 
-    // 2. Calcula fluxo máximo
-    FFStats stats;
-    int max_flow = ford_fulkerson(
-        graph,
-        graph.get_source(),
-        graph.get_sink(),
-        capacity_scaling_path,
-        AlgorithmType::CAPACITY_SCALING,
-        &stats
-    );
+    for (int a = 1; a < argc; ++a) {
+        std::string arg = argv[a];
+        if (arg == "--min-wins") {
+            min_wins_mode = true;
+        } else if (arg == "--stream") {
+            stream_mode = true;
+        } else if (arg == "--binary") {
+            binary_mode = true;
+        } else if (arg == "--batch") {
+            batch_mode = true;
+        } else if (arg == "--what-if") {
+            what_if_mode = true;
+        } else if (arg == "--critical") {
+            critical_mode = true;
+        } else if (arg == "--certificate") {
+            certificate_mode = true;
+        } else if (arg == "--warm-start") {
+            warm_start = true;
+        } else if (arg == "--cache" && a + 1 < argc) {
+            cache_dir = argv[++a];
+        } else if (arg == "--verify" && a + 1 < argc) {
+            verify_list = argv[++a];
+        } else if (arg == "--simulate" && a + 1 < argc) {
+            try {
+                simulate_samples = std::stoll(argv[++a]);
+            } catch (const std::exception&) {
+                return usage();
+            }
+        } else if (arg == "--alpha" && a + 1 < argc) {
+            try {
+                alpha = std::stod(argv[++a]);
+                simulate_options = true;
+            } catch (const std::exception&) {
+                return usage();
+            }
+        } else if (arg == "--bias" && a + 1 < argc) {
+            try {
+                bias = std::stod(argv[++a]);
+                simulate_options = true;
+            } catch (const std::exception&) {
+                return usage();
+            }
+        } else if (arg == "--model" && a + 1 < argc) {
+            model_name = argv[++a];
+            simulate_options = true;
+        } else if (arg == "--seed" && a + 1 < argc) {
+            try {
+                seed = std::stoull(argv[++a]);
+                simulate_options = true;
+            } catch (const std::exception&) {
+                return usage();
+            }
+        } else if (arg == "--threads" && a + 1 < argc) {
+            try {
+                threads = std::stoi(argv[++a]);
+                solver_options = true;
+            } catch (const std::exception&) {
+                return usage();
+            }
+        } else if (arg == "--order" && a + 1 < argc) {
+            try {
+                node_order = parse_node_order(argv[++a]);
+                solver_options = true;
+            } catch (const std::exception&) {
+                return usage();
+            }
+        } else if (arg == "--engine" && a + 1 < argc) {
+            try {
+                engine = parse_decision_engine(argv[++a]);
+                solver_options = true;
+            } catch (const std::exception&) {
+                return usage();
+            }
+        } else if (arg == "--engine-model" && a + 1 < argc) {
+            engine_model_path = argv[++a];
+            solver_options = true;
+        } else {
+            return usage();
+        }
+    }
 
-    // 3. Verifica total de partidas restantes do time 1
-    int total_remaining_games = graph.total_out_capacity(graph.get_source());
+    // Um modo por execução: combinações como --certificate --min-wins são recusadas em vez de
+    // uma delas ser escolhida em silêncio; --batch só existe com --binary, o cache só guarda
+    // a decisão simples e as opções da simulação só valem com --simulate
+    const int modes = min_wins_mode + stream_mode + binary_mode + what_if_mode + critical_mode +
+                      certificate_mode + !verify_list.empty() + (simulate_samples > 0);
+    if (modes > 1 || (batch_mode && !binary_mode) || (!cache_dir.empty() && modes > 0) ||
+        simulate_samples < 0 || (simulate_options && simulate_samples == 0)) {
+        return usage();
+    }
 
+    // O lote tem resolvedor próprio (fluxo guloso inicial e busca bit a bit, numa thread):
+    // threads, ordem e motor não teriam efeito, então são recusados em vez de ignorados
+    if (batch_mode && solver_options) return usage();
 
+    // Motor auto: a calibração embutida, ou a do arquivo pedido com --engine-model (que só
+    // vale com --engine auto e, se não puder ser lido, encerra em vez de cair na embutida)
+    if (!engine_model_path.empty() && engine != DecisionEngine::AUTO) return usage();
+    EngineModel engine_model;
+    if (!engine_model_path.empty() && !engine_model.load(engine_model_path)) {
+        std::cerr << "erro: não foi possível ler o modelo " << engine_model_path << "\n";
+        return 1;
+    }
 
-    // 4. Decide se o time 1 pode vencer
+    // Modo servidor: uma resposta por instância (torneios ou blocos DIMACS) até o fim da entrada
+    if (stream_mode) {
+        serve_stream(std::cin, std::cout, threads, node_order, engine, engine_model, warm_start);
+        return 0;
+    }
 
-    if (graph.get_cant_be_champion()) {
-        std::cout << "não\n";
-    }else if(max_flow == total_remaining_games)
-        std::cout << "sim\n";
-    else
-        std::cout << "não\n";
+    // Registros binários concatenados (bin/gen_dataset --binary): um "sim"/"não" por instância
+    if (binary_mode && batch_mode) {
+        // Blocos de registros resolvidos em lote, vários torneios do mesmo tamanho de cada vez
+        constexpr size_t BLOCK = 1024;
+        std::vector<Tournament> block;
+        std::vector<char> answers;
+        Tournament tournament;
+        bool invalid = false;
+        while (!invalid && std::cin.peek() != EOF) {
+            block.clear();
+            while (block.size() < BLOCK && std::cin.peek() != EOF) {
+                if (!read_tournament_binary(std::cin, tournament)) {
+                    invalid = true;
+                    break;
+                }
+                block.push_back(tournament);
+            }
+            batch_team1_can_win(block, answers);
+            for (size_t k = 0; k < block.size(); ++k) {
+                if (block[k].n < 2) {
+                    std::cout << "erro: torneio incompleto\n";
+                } else {
+                    std::cout << (answers[k] ? "sim\n" : "não\n");
+                }
+            }
+        }
+        // Um registro truncado ou inválido encerra a leitura: os seguintes não têm onde começar
+        if (invalid) {
+            std::cout << "erro: registro inválido\n";
+            return 1;
+        }
+        return 0;
+    }
+    if (binary_mode) {
+        ComponentSolver solver(threads, node_order, engine, engine_model, warm_start);
+        Tournament tournament;
+        while (std::cin.peek() != EOF) {
+            if (!read_tournament_binary(std::cin, tournament)) {
+                std::cout << "erro: registro inválido\n";
+                return 1;
+            }
+            if (tournament.n < 2) {
+                std::cout << "erro: torneio incompleto\n";
+                continue;
+            }
+            std::cout << (team1_can_win(tournament, solver) ? "sim\n" : "não\n");
+        }
+        return 0;
+    }
+
+    // Cache de resultados (só na decisão simples): a entrada é consultada pelo hash do seu
+    // texto antes de montar o torneio; numa falta, a decisão de sempre é resolvida e guardada
+    if (!cache_dir.empty()) {
+        std::string input{std::istreambuf_iterator<char>(std::cin), std::istreambuf_iterator<char>()};
+        ResultCache cache(cache_dir);
+        // As estatísticas guardadas dependem do fluxo inicial guloso, não só do motor
+        const std::string key = instance_key(input.data(), input.size(),
+                                             std::string(decision_engine_name(engine)) + (warm_start ? "+warm-start" : ""));
+        CachedResult result;
+        if (!cache.load(key, result)) {
+            std::istringstream in(input);
+            Tournament tournament;
+            if (!read_tournament(in, tournament) || tournament.n < 2) {
+                std::cerr << "erro: torneio inválido\n";
+                return 1;
+            }
+            ComponentSolver solver(threads, node_order, engine, engine_model, warm_start);
+            result = solve_for_cache(tournament, solver);
+            cache.store(key, result);
+        }
+        std::cout << (result.team1_can_win ? "sim\n" : "não\n");
+        return 0;
+    }
+
+    // 1. Lê o torneio (um torneio truncado ou malformado não é resolvido pela metade)
+    Tournament tournament;
+    if (!read_tournament(std::cin, tournament) || tournament.n < 2) {
+        std::cerr << "erro: torneio inválido\n";
+        return 1;
+    }
+
+    // Cenários: depois do torneio, uma linha por comando, cada uma respondida com "sim"/"não"
+    //   jogo I J V   uma partida entre I e J (times de 1 a n) vencida por V
+    //   marca        guarda o cenário atual
+    //   desfaz       volta à última marca (ou ao torneio lido, se não houver)
+    if (what_if_mode) {
+        ScenarioExplorer explorer(tournament);
+        std::cout << (explorer.team1_alive() ? "sim\n" : "não\n");
+        std::string line;
+        while (std::getline(std::cin, line)) {
+            std::istringstream command(line);
+            std::string name;
+            if (!(command >> name)) continue;
+            if (name == "jogo") {
+                int i, j, v;
+                if (!(command >> i >> j >> v)) {
+                    std::cout << "erro: use jogo I J V\n";
+                    continue;
+                }
+                try {
+                    explorer.play(i - 1, j - 1, v - 1);
+                } catch (const std::invalid_argument&) {
+                    std::cout << "erro: jogo inválido\n";
+                    continue;
+                }
+            } else if (name == "marca") {
+                explorer.checkpoint();
+            } else if (name == "desfaz") {
+                explorer.rollback();
+            } else {
+                std::cout << "erro: comando desconhecido\n";
+                continue;
+            }
+            std::cout << (explorer.team1_alive() ? "sim\n" : "não\n");
+        }
+        return 0;
+    }
+
+    // Simulação: joga uma fração alpha das partidas restantes em cada amostra e estima a
+    // chance de o time 1 ainda poder terminar em primeiro, com intervalo de confiança de 95%
+    if (simulate_samples > 0) {
+        if (alpha < 0.0 || alpha > 1.0 || (model_name != "even" && model_name != "random")) {
+            std::cerr << "erro: use 0 <= alpha <= 1 e --model even ou random\n";
+            return 1;
+        }
+        WinModel model = model_name == "even" ? even_win_model(tournament, bias)
+                                              : random_win_model(tournament, bias, seed);
+        SimulationResult r = simulate_championship(tournament, model, alpha, simulate_samples, threads, seed);
+        std::cout << r.probability << " [" << r.ci_low << ", " << r.ci_high << "] "
+                  << r.alive << "/" << r.samples << " amostras, " << r.flow_solves << " por fluxo\n";
+        return 0;
+    }
+
+    // Certificado: na eliminação, o conjunto R de times que precisa ganhar entre si mais
+    // jogos do que a soma das suas folgas
+    if (certificate_mode) {
+        EliminationCertificate cert;
+        if (!find_elimination_certificate(tournament, cert)) {
+            std::cout << "sim\n";
+            return 0;
+        }
+        std::cout << "não\ncertificado:";
+        for (int i : cert.teams) std::cout << " " << i + 1;
+        std::cout << " (jogos " << cert.games << " > folga " << cert.slack << ")\n";
+        return 0;
+    }
+
+    // Revalida um certificado guardado contra a classificação lida, sem fluxo
+    if (!verify_list.empty()) {
+        std::vector<int> teams;
+        std::istringstream list(verify_list);
+        std::string item;
+        while (std::getline(list, item, ',')) {
+            try {
+                teams.push_back(std::stoi(item) - 1);
+            } catch (const std::exception&) {
+                std::cerr << "erro: lista de times inválida\n";
+                return 1;
+            }
+        }
+        std::cout << (verify_elimination_certificate(tournament, teams) ? "válido\n" : "inválido\n");
+        return 0;
+    }
+
+    // Jogos decisivos: a resposta e, numa linha cada, os resultados que a mudariam,
+    // tirados do grafo residual de um único fluxo máximo
+    if (critical_mode) {
+        SensitivityReport report = critical_games(tournament);
+        std::cout << (report.team1_can_win ? "sim\n" : "não\n");
+        for (const GameSensitivity& g : report.games) {
+            if (g.flips_if_i_wins) std::cout << g.i + 1 << " " << g.j + 1 << ": vitória de " << g.i + 1 << " muda a resposta\n";
+            if (g.flips_if_j_wins) std::cout << g.i + 1 << " " << g.j + 1 << ": vitória de " << g.j + 1 << " muda a resposta\n";
+        }
+        return 0;
+    }
+
+    // Modo paramétrico: quantas das partidas restantes o time 1 precisa vencer (-1 = nenhuma quantidade basta)
+    if (min_wins_mode) {
+        std::cout << min_required_wins(tournament) << "\n";
+        return 0;
+    }
+
+    // 2. Pré-filtro, redução e, se preciso, fluxo em cada componente independente
+    //    (resolvidas em paralelo, parando na primeira que elimina o time 1)
+    ComponentSolver solver(threads, node_order, engine, engine_model, warm_start);
+    bool saturates = team1_can_win(tournament, solver);
+
+    // 3. Decide se o time 1 pode vencer
+    std::cout << (saturates ? "sim\n" : "não\n");
 
     return 0;
 }
\ No newline at end of file
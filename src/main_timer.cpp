@@ -5,42 +5,82 @@
 #include "find_path_headers/dfs_random.hpp"
 #include "find_path_headers/fattest.hpp"
 #include "find_path_headers/capacity_scaling.hpp"
+#include "warm_start.hpp"
+#include "tournament.hpp"
+#include "prefilter.hpp"
+#include "presolve.hpp"
+#include "components.hpp"
 
 
 #include <iostream>
 #include <string>
 #include <chrono>
 
-int main() {
+int main(int argc, char* argv[]) {
+    // Sem opções mede o mesmo de sempre (rede completa + Ford-Fulkerson com capacity scaling),
+    // que é o que execution_times.csv registra.
+    //   --pipeline    mede a decisão do tournament: pré-filtro, redução, componentes e fluxo em modo decisão
+    //   --warm-start  o fluxo parte do fluxo guloso em vez do fluxo zero
+    bool pipeline = false;
+    bool warm_start = false;
+    for (int a = 1; a < argc; ++a) {
+        std::string arg = argv[a];
+        if (arg == "--pipeline") {
+            pipeline = true;
+        } else if (arg == "--warm-start") {
+            warm_start = true;
+        } else {
+            std::cerr << "Uso: " << argv[0] << " [--pipeline] [--warm-start] < torneio\n";
+            return 1;
+        }
+    }
+
     auto start = std::chrono::high_resolution_clock::now();
-    
-     // 1. Constrói o grafo a partir do torneio
-    Graph graph;
-    graph.fromTournament(std::cin);
-
-
-    // 2. Calcula fluxo máximo
-    FFStats stats;
-    int max_flow = ford_fulkerson(
-        graph,
-        graph.get_source(),
-        graph.get_sink(),
-        capacity_scaling_path,
-        AlgorithmType::CAPACITY_SCALING,
-        &stats
-    );
-
-    // 3. Verifica total de partidas restantes do time 1
-    int total_remaining_games = graph.total_out_capacity(graph.get_source());
-
-    (void)max_flow;
-    (void)total_remaining_games;
-
-        
+
+    if (pipeline) {
+        // 1. Lê o torneio; o pré-filtro pode decidir sem resolver fluxo
+        Tournament tournament = read_tournament(std::cin);
+
+        if (elimination_prefilter(tournament) == PrefilterResult::INCONCLUSIVE) {
+            // 1.1 Reduz o torneio e separa os jogos em componentes independentes
+            ReducedNetwork reduced = presolve_tournament(tournament);
+
+            // 2. Decide se o fluxo máximo satura as partidas de todas as componentes
+            bool saturates = !reduced.cant_be_champion &&
+                             all_components_saturate(split_components(reduced), 0, NodeOrder::NONE,
+                                                     DecisionEngine::CAPACITY_SCALING, warm_start);
+
+            (void)saturates;
+        }
+    } else {
+        // 1. Constrói o grafo a partir do torneio
+        Graph graph;
+        graph.fromTournament(std::cin);
+        if (warm_start) greedy_warm_start(graph, graph.get_source(), graph.get_sink());
+
+        // 2. Calcula fluxo máximo
+        FFStats stats;
+        int max_flow = ford_fulkerson(
+            graph,
+            graph.get_source(),
+            graph.get_sink(),
+            capacity_scaling_path<int>,
+            AlgorithmType::CAPACITY_SCALING,
+            &stats
+        );
+
+        // 3. Verifica total de partidas restantes do time 1
+        int total_remaining_games = graph.total_out_capacity(graph.get_source());
+
+        (void)max_flow;
+        (void)total_remaining_games;
+    }
+
+
     auto end = std::chrono::high_resolution_clock::now();
 
     std::chrono::duration<double> duration = end - start;
     std::cout << duration.count() << std::endl;
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,63 @@
+#include "parametric.hpp"
+#include "graph.hpp"
+#include "ford_fulkerson.hpp"
+#include "warm_start.hpp"
+#include "find_path_headers/capacity_scaling.hpp"
+#include <vector>
+#include <algorithm>
+
+int min_required_wins(const Tournament& t, int* solves) {
+    const int n = t.n;
+    const int r1 = t.remaining_games(0);
+
+    int total_games = 0;
+    for (const Fixture& f : t.fixtures) total_games += f.games;
+
+    // Lower bound 1: team 1 must pass every team's current wins
+    int k = 0;
+    for (int i = 1; i < n; ++i) k = std::max(k, t.w[i] - t.w[0] + 1);
+
+    // Lower bound 2: the sink arcs must be able to absorb every remaining game
+    long long base = 0; // sum of sink capacities at k = 0
+    for (int i = 1; i < n; ++i) base += t.w[0] - t.w[i] - 1;
+    if (total_games > base) {
+        k = std::max<long long>(k, (total_games - base + n - 1) / n);
+    }
+
+    int runs = 0;
+    int answer = -1;
+
+    if (k <= r1) {
+        Graph graph;
+        graph.fromTournamentParametric(t, k);
+        int s = graph.get_source();
+        int snk = graph.get_sink();
+        int target = graph.total_out_capacity(s);
+
+        greedy_warm_start(graph, s, snk);
+
+        auto& adj = graph.get_adj();
+        while (true) {
+            FFStats stats;
+            int flow = ford_fulkerson(graph, s, snk, capacity_scaling_path, AlgorithmType::CAPACITY_SCALING, &stats);
+            ++runs;
+
+            if (flow == target) {
+                answer = k;
+                break;
+            }
+
+            int step = (target - flow + n - 1) / n;
+            if (k + step > r1) break;
+            k += step;
+
+            // Raise every sink arc by `step`; the current flow remains feasible
+            for (const Edge& e : adj[snk]) {
+                adj[e.to][e.rev].capacity += step;
+            }
+        }
+    }
+
+    if (solves) *solves = runs;
+    return answer;
+}
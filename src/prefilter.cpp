@@ -0,0 +1,50 @@
+#include "prefilter.hpp"
+#include <algorithm>
+#include <numeric>
+
+PrefilterResult elimination_prefilter(const Tournament& t, std::vector<int>* certificate) {
+    const int n = t.n;
+    std::vector<int> m = t.slack();
+
+    auto eliminated = [&](std::vector<int> R) {
+        if (certificate) *certificate = std::move(R);
+        return PrefilterResult::ELIMINATED;
+    };
+
+    // 1. Single teams: already more wins than team 1 can reach
+    for (int i = 1; i < n; ++i) {
+        if (m[i] < 0) return eliminated({i});
+    }
+
+    // 2. Pairs: games between i and j alone exceed their combined slack
+    for (const Fixture& f : t.fixtures) {
+        if (f.i > 0 && f.games > m[f.i] + m[f.j]) return eliminated({f.i, f.j});
+    }
+
+    // 3. Prefixes of the teams sorted by slack (strongest teams first)
+    std::vector<int> order(n - 1);
+    std::iota(order.begin(), order.end(), 1);
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return m[a] < m[b]; });
+
+    std::vector<int> pos(n, -1);
+    for (int k = 0; k < n - 1; ++k) pos[order[k]] = k;
+
+    // games_at[k] = games between order[k] and teams placed before it
+    std::vector<long long> games_at(n - 1, 0);
+    for (const Fixture& f : t.fixtures) {
+        if (f.i == 0) continue;
+        games_at[std::max(pos[f.i], pos[f.j])] += f.games;
+    }
+
+    long long games_in_prefix = 0;
+    long long slack_in_prefix = 0;
+    for (int k = 0; k < n - 1; ++k) {
+        games_in_prefix += games_at[k];
+        slack_in_prefix += m[order[k]];
+        if (games_in_prefix > slack_in_prefix) {
+            return eliminated(std::vector<int>(order.begin(), order.begin() + k + 1));
+        }
+    }
+
+    return PrefilterResult::INCONCLUSIVE;
+}
@@ -0,0 +1,170 @@
+#include "presolve.hpp"
+#include <algorithm>
+#include <map>
+#include <tuple>
+#include <utility>
+
+// Removes non-limiting nodes until none is left and renumbers the survivors
+static void drop_non_limiting(ReducedNetwork& net) {
+    const int k = net.slack.size();
+
+    std::vector<long long> load(k, 0);
+    std::vector<std::vector<int>> touching(k); // fixture indices per node
+    for (int f = 0; f < static_cast<int>(net.fixtures.size()); ++f) {
+        const Fixture& fx = net.fixtures[f];
+        load[fx.i] += fx.games;
+        touching[fx.i].push_back(f);
+        if (fx.j != fx.i) {
+            load[fx.j] += fx.games;
+            touching[fx.j].push_back(f);
+        }
+    }
+
+    std::vector<char> alive(k, 1);
+    std::vector<char> fixture_alive(net.fixtures.size(), 1);
+    std::vector<int> pending;
+    for (int v = 0; v < k; ++v) {
+        if (net.slack[v] >= load[v]) pending.push_back(v);
+    }
+
+    while (!pending.empty()) {
+        int v = pending.back();
+        pending.pop_back();
+        if (!alive[v]) continue;
+        alive[v] = 0;
+
+        // Hand every remaining game of v to v; its opponents lose that load
+        for (int f : touching[v]) {
+            if (!fixture_alive[f]) continue;
+            fixture_alive[f] = 0;
+            const Fixture& fx = net.fixtures[f];
+            net.credited_games += fx.games;
+
+            int other = (fx.i == v) ? fx.j : fx.i;
+            if (other == v) continue;
+            load[other] -= fx.games;
+            if (alive[other] && net.slack[other] >= load[other]) pending.push_back(other);
+        }
+    }
+
+    // Compact the surviving nodes and fixtures
+    std::vector<int> new_id(k, -1);
+    ReducedNetwork out;
+    out.credited_games = net.credited_games;
+    out.cant_be_champion = net.cant_be_champion;
+    for (int v = 0; v < k; ++v) {
+        if (!alive[v]) continue;
+        new_id[v] = out.slack.size();
+        out.slack.push_back(net.slack[v]);
+        out.members.push_back(std::move(net.members[v]));
+    }
+    for (int f = 0; f < static_cast<int>(net.fixtures.size()); ++f) {
+        if (!fixture_alive[f]) continue;
+        const Fixture& fx = net.fixtures[f];
+        out.fixtures.push_back({new_id[fx.i], new_id[fx.j], fx.games});
+    }
+
+    net = std::move(out);
+}
+
+// Merges teams whose rows agree everywhere except on each other ("twins").
+// Only valid while every node is a single team (no internal fixtures yet).
+static void merge_identical(ReducedNetwork& net) {
+    const int k = net.slack.size();
+
+    // row[v] = sorted (opponent, games)
+    std::vector<std::vector<std::pair<int, int>>> row(k);
+    std::vector<long long> load(k, 0);
+    for (const Fixture& fx : net.fixtures) {
+        row[fx.i].push_back({fx.j, fx.games});
+        row[fx.j].push_back({fx.i, fx.games});
+        load[fx.i] += fx.games;
+        load[fx.j] += fx.games;
+    }
+    for (auto& r : row) std::sort(r.begin(), r.end());
+
+    // a and b are twins if their rows agree on every team other than a and b.
+    // Twins of a common representative are also twins of each other and play each
+    // other equally often, so a whole group can be merged.
+    auto twins = [&](int a, int b) {
+        size_t x = 0, y = 0;
+        const auto& ra = row[a];
+        const auto& rb = row[b];
+        while (true) {
+            while (x < ra.size() && (ra[x].first == a || ra[x].first == b)) ++x;
+            while (y < rb.size() && (rb[y].first == a || rb[y].first == b)) ++y;
+            if (x == ra.size() || y == rb.size()) return x == ra.size() && y == rb.size();
+            if (ra[x] != rb[y]) return false;
+            ++x;
+            ++y;
+        }
+    };
+
+    // Only teams with the same slack, load and degree can be twins
+    std::map<std::tuple<int, long long, size_t>, std::vector<int>> buckets;
+    for (int v = 0; v < k; ++v) {
+        buckets[{net.slack[v], load[v], row[v].size()}].push_back(v);
+    }
+
+    std::vector<int> group(k, -1);
+    int groups = 0;
+    for (auto& [key, teams] : buckets) {
+        for (size_t a = 0; a < teams.size(); ++a) {
+            if (group[teams[a]] != -1) continue;
+            group[teams[a]] = groups;
+            for (size_t b = a + 1; b < teams.size(); ++b) {
+                if (group[teams[b]] == -1 && twins(teams[a], teams[b])) group[teams[b]] = groups;
+            }
+            ++groups;
+        }
+    }
+
+    if (groups == k) return; // Nothing to merge
+
+    ReducedNetwork out;
+    out.credited_games = net.credited_games;
+    out.cant_be_champion = net.cant_be_champion;
+    out.slack.assign(groups, 0);
+    out.members.assign(groups, {});
+    for (int v = 0; v < k; ++v) {
+        out.slack[group[v]] += net.slack[v];
+        for (int team : net.members[v]) out.members[group[v]].push_back(team);
+    }
+
+    // Games between (or inside) groups are summed into one game node
+    std::map<std::pair<int, int>, int> games;
+    for (const Fixture& fx : net.fixtures) {
+        int a = group[fx.i];
+        int b = group[fx.j];
+        games[{std::min(a, b), std::max(a, b)}] += fx.games;
+    }
+    for (const auto& [pair, count] : games) {
+        out.fixtures.push_back({pair.first, pair.second, count});
+    }
+
+    net = std::move(out);
+}
+
+ReducedNetwork presolve_tournament(const Tournament& t) {
+    ReducedNetwork net;
+    std::vector<int> m = t.slack();
+
+    // node v = team v + 1 (teams 2..n)
+    for (int i = 1; i < t.n; ++i) {
+        if (m[i] < 0) {
+            net.cant_be_champion = true;
+            m[i] = 0;
+        }
+        net.slack.push_back(m[i]);
+        net.members.push_back({i});
+    }
+    for (const Fixture& f : t.fixtures) {
+        if (f.i > 0) net.fixtures.push_back({f.i - 1, f.j - 1, f.games});
+    }
+
+    drop_non_limiting(net);
+    merge_identical(net);
+    drop_non_limiting(net);
+
+    return net;
+}
@@ -0,0 +1,265 @@
+#include "push_relabel.hpp"
+#include "thread_pool.hpp"
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+namespace {
+
+// Flat (CSR) copy of the residual graph shared by all threads.
+// Arc a = offset[u] + i mirrors adj[u][i]; only flows, excesses and heights change.
+struct SharedNetwork {
+    int n = 0;
+    std::vector<int> offset;
+    std::vector<int> to;
+    std::vector<int> rev;
+    std::vector<int> cap;
+    std::unique_ptr<std::atomic<int>[]> flow;
+    std::unique_ptr<std::atomic<long long>[]> excess;
+    std::unique_ptr<std::atomic<int>[]> height;
+
+    int residual(int a) const {
+        return cap[a] - flow[a].load(std::memory_order_relaxed);
+    }
+};
+
+// Active nodes owned by one thread; other threads steal from the front
+struct alignas(64) WorkQueue {
+    std::mutex mutex;
+    std::deque<int> nodes;
+
+    void push(int u) {
+        std::lock_guard<std::mutex> lock(mutex);
+        nodes.push_back(u);
+    }
+
+    bool pop_back(int& u) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (nodes.empty()) return false;
+        u = nodes.back();
+        nodes.pop_back();
+        return true;
+    }
+
+    bool steal_front(int& u) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (nodes.empty()) return false;
+        u = nodes.front();
+        nodes.pop_front();
+        return true;
+    }
+};
+
+// Exact distance labels: distance to t in the residual graph, or n + distance to s
+// for nodes that can only send their excess back, or 2n for everything else.
+void global_relabel(SharedNetwork& net, int s, int t) {
+    const int n = net.n;
+    std::vector<int> h(n, -1);
+    std::queue<int> q;
+
+    auto bfs_from = [&](int root, int base) {
+        h[root] = base;
+        q.push(root);
+        while (!q.empty()) {
+            int v = q.front();
+            q.pop();
+            for (int a = net.offset[v]; a < net.offset[v + 1]; ++a) {
+                int u = net.to[a];
+                // Arc u -> v is the reverse of v -> u
+                if (h[u] == -1 && net.residual(net.rev[a]) > 0) {
+                    h[u] = h[v] + 1;
+                    q.push(u);
+                }
+            }
+        }
+    };
+
+    bfs_from(t, 0);
+    if (h[s] == -1) {
+        bfs_from(s, n);
+    }
+    h[s] = n;
+
+    for (int v = 0; v < n; ++v) {
+        net.height[v].store(h[v] == -1 ? 2 * n : h[v], std::memory_order_relaxed);
+    }
+}
+
+} // namespace
+
+int parallel_push_relabel(Graph& graph, int s, int t, int threads, FFStats* stats) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    ThreadPool pool(threads > 0 ? threads : ThreadPool::default_threads());
+    const int workers = pool.size();
+    const int n = graph.size();
+    auto& adj = graph.get_adj();
+
+    // 1. Flatten the graph
+    SharedNetwork net;
+    net.n = n;
+    net.offset.assign(n + 1, 0);
+    for (int u = 0; u < n; ++u) net.offset[u + 1] = net.offset[u] + adj[u].size();
+    const int arcs = net.offset[n];
+    net.to.resize(arcs);
+    net.rev.resize(arcs);
+    net.cap.resize(arcs);
+    net.flow = std::make_unique<std::atomic<int>[]>(arcs);
+    net.excess = std::make_unique<std::atomic<long long>[]>(n);
+    net.height = std::make_unique<std::atomic<int>[]>(n);
+
+    for (int u = 0; u < n; ++u) {
+        for (int i = 0; i < static_cast<int>(adj[u].size()); ++i) {
+            const Edge& e = adj[u][i];
+            int a = net.offset[u] + i;
+            net.to[a] = e.to;
+            net.rev[a] = net.offset[e.to] + e.rev;
+            net.cap[a] = e.capacity;
+            net.flow[a].store(e.flow, std::memory_order_relaxed);
+        }
+        net.excess[u].store(0, std::memory_order_relaxed);
+    }
+
+    // 2. Initial preflow: saturate every arc leaving s
+    std::vector<WorkQueue> queues(workers);
+    std::atomic<long long> active{0};
+    int next_queue = 0;
+
+    for (int a = net.offset[s]; a < net.offset[s + 1]; ++a) {
+        int r = net.residual(a);
+        if (r <= 0) continue;
+        int v = net.to[a];
+        net.flow[a].fetch_add(r);
+        net.flow[net.rev[a]].fetch_sub(r);
+        long long before = net.excess[v].fetch_add(r);
+        if (before == 0 && v != t && v != s) {
+            queues[next_queue].push(v);
+            next_queue = (next_queue + 1) % workers;
+            active.fetch_add(1);
+        }
+    }
+
+    global_relabel(net, s, t);
+
+    // 3. Parallel phases separated by global relabels
+    std::vector<long long> pushes(workers, 0);
+    std::vector<long long> relabels(workers, 0);
+    std::atomic<bool> pause{false};
+    std::atomic<long long> relabels_since_global{0};
+    int global_relabels = 0;
+
+    // Discharges u until its excess reaches zero (ownership released) or a pause is requested.
+    // Returns false if u is still owned and must be requeued.
+    auto discharge = [&](int tid, int u) {
+        while (true) {
+            if (pause.load(std::memory_order_relaxed)) return false;
+
+            long long e = net.excess[u].load(std::memory_order_acquire);
+
+            // Lowest neighbour reachable through a residual arc (heights may be stale)
+            int lowest = INT_MAX;
+            int best = -1;
+            for (int a = net.offset[u]; a < net.offset[u + 1]; ++a) {
+                if (net.residual(a) <= 0) continue;
+                int h = net.height[net.to[a]].load(std::memory_order_relaxed);
+                if (h < lowest) {
+                    lowest = h;
+                    best = a;
+                }
+            }
+            if (best == -1) return true; // Cannot happen for a node with positive excess
+
+            if (net.height[u].load(std::memory_order_relaxed) > lowest) {
+                // Push: only u pushes on arcs out of u, so the residual read above is a lower bound
+                long long delta = std::min<long long>(e, net.residual(best));
+                int v = net.to[best];
+                net.flow[best].fetch_add(static_cast<int>(delta), std::memory_order_relaxed);
+                net.flow[net.rev[best]].fetch_sub(static_cast<int>(delta), std::memory_order_relaxed);
+                ++pushes[tid];
+
+                long long before_v = net.excess[v].fetch_add(delta, std::memory_order_acq_rel);
+                if (before_v == 0 && v != s && v != t) {
+                    // v just became active: this thread now owns it
+                    active.fetch_add(1);
+                    queues[tid].push(v);
+                }
+
+                long long before_u = net.excess[u].fetch_sub(delta, std::memory_order_acq_rel);
+                if (before_u == delta) {
+                    // Excess hit zero: release u (a later push will re-activate it)
+                    active.fetch_sub(1);
+                    return true;
+                }
+            } else {
+                net.height[u].store(lowest + 1, std::memory_order_relaxed);
+                ++relabels[tid];
+                if (relabels_since_global.fetch_add(1, std::memory_order_relaxed) + 1 >= n) {
+                    pause.store(true, std::memory_order_relaxed);
+                }
+            }
+        }
+    };
+
+    auto worker = [&](int tid) {
+        while (!pause.load(std::memory_order_relaxed)) {
+            int u;
+            bool got = queues[tid].pop_back(u);
+            for (int k = 1; !got && k < workers; ++k) {
+                got = queues[(tid + k) % workers].steal_front(u);
+            }
+
+            if (!got) {
+                if (active.load() == 0) return;
+                std::this_thread::yield();
+                continue;
+            }
+
+            if (!discharge(tid, u)) {
+                queues[tid].push(u); // Still owned, resume after the global relabel
+            }
+        }
+    };
+
+    while (active.load() > 0) {
+        pause.store(false);
+        relabels_since_global.store(0);
+        pool.run(worker);
+
+        if (active.load() > 0) {
+            global_relabel(net, s, t);
+            ++global_relabels;
+        }
+    }
+
+    // 4. Copy the final flow back into the graph
+    long long total_pushes = 0;
+    for (int u = 0; u < n; ++u) {
+        for (int i = 0; i < static_cast<int>(adj[u].size()); ++i) {
+            adj[u][i].flow = net.flow[net.offset[u] + i].load(std::memory_order_relaxed);
+        }
+    }
+    for (long long p : pushes) total_pushes += p;
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> elapsed = end - start;
+
+    stats->n = n;
+    stats->m = graph.num_edges();
+    stats->m_residual = arcs;
+    stats->iterations = static_cast<int>(std::min<long long>(total_pushes, INT_MAX));
+    stats->bound = static_cast<double>(n) * n * arcs;
+    stats->r = stats->bound > 0 ? total_pushes / stats->bound : 0.0;
+    stats->total_runtime = elapsed.count();
+    stats->pushes_per_thread = pushes;
+    stats->relabels_per_thread = relabels;
+    stats->global_relabels = global_relabels;
+
+    return graph.net_out_flow(s);
+}
@@ -0,0 +1,154 @@
+#include "reorder.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+// Appends to `order` every node reachable from root (ignoring capacities) in BFS order.
+// With by_degree set, the neighbours of each node are enqueued by increasing degree (Cuthill-McKee).
+template <typename Cap>
+void bfs_append(const BasicGraph<Cap>& graph, int root, bool by_degree,
+                std::vector<char>& placed, std::vector<int>& order) {
+    std::vector<int> next;
+
+    size_t head = order.size();
+    placed[root] = 1;
+    order.push_back(root);
+    while (head < order.size()) {
+        int u = order[head++];
+        next.clear();
+        for (const auto& e : graph.adj(u)) {
+            if (!placed[e.to]) {
+                placed[e.to] = 1;
+                next.push_back(e.to);
+            }
+        }
+        if (by_degree) {
+            std::stable_sort(next.begin(), next.end(), [&](int a, int b) {
+                return graph.adj(a).size() < graph.adj(b).size();
+            });
+        }
+        order.insert(order.end(), next.begin(), next.end());
+    }
+}
+
+template <typename Cap>
+std::vector<int> bfs_order(const BasicGraph<Cap>& graph) {
+    std::vector<char> placed(graph.size(), 0);
+    std::vector<int> order;
+    order.reserve(graph.size());
+
+    int s = graph.get_source();
+    if (s >= 0) bfs_append(graph, s, false, placed, order);
+    for (int u = 0; u < graph.size(); ++u) {
+        if (!placed[u]) bfs_append(graph, u, false, placed, order);
+    }
+    return order;
+}
+
+template <typename Cap>
+std::vector<int> rcm_order(const BasicGraph<Cap>& graph) {
+    std::vector<char> placed(graph.size(), 0);
+    std::vector<int> order;
+    order.reserve(graph.size());
+
+    // One Cuthill-McKee sweep per connected component, each from its lowest-degree node
+    // (lowest index among equal degrees): one pass over the nodes sorted by degree
+    std::vector<int> by_degree(graph.size());
+    for (int u = 0; u < graph.size(); ++u) by_degree[u] = u;
+    std::stable_sort(by_degree.begin(), by_degree.end(), [&](int a, int b) {
+        return graph.adj(a).size() < graph.adj(b).size();
+    });
+    for (int root : by_degree) {
+        if (!placed[root]) bfs_append(graph, root, true, placed, order);
+    }
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+// s, then for every node v with an arc into t: the not yet placed predecessors of v, then v.
+// In a tournament network this lays out each team right after its games, so the
+// game -> team -> sink hops of a search stay within a few cache lines.
+template <typename Cap>
+std::vector<int> team_major_order(const BasicGraph<Cap>& graph) {
+    const int n = graph.size();
+    const int s = graph.get_source();
+    const int t = graph.get_sink();
+    std::vector<char> placed(n, 0);
+    std::vector<int> order;
+    order.reserve(n);
+
+    auto place = [&](int u) {
+        if (u >= 0 && !placed[u]) {
+            placed[u] = 1;
+            order.push_back(u);
+        }
+    };
+
+    place(s);
+    if (t >= 0) {
+        for (const auto& in : graph.adj(t)) {
+            int v = in.to;
+            if (placed[v] || graph.adj(v)[in.rev].capacity <= 0) continue;
+            for (const auto& e : graph.adj(v)) {
+                // Residual arc v -> x with a real x -> v arc behind it
+                if (e.to != t && graph.adj(e.to)[e.rev].capacity > 0) place(e.to);
+            }
+            place(v);
+        }
+    }
+    for (int u = 0; u < n; ++u) {
+        if (u != t) place(u);
+    }
+    place(t);
+    return order;
+}
+
+} // namespace
+
+NodeOrder parse_node_order(const std::string& name) {
+    if (name == "none") return NodeOrder::NONE;
+    if (name == "bfs") return NodeOrder::BFS;
+    if (name == "rcm") return NodeOrder::REVERSE_CUTHILL_MCKEE;
+    if (name == "team") return NodeOrder::TEAM_MAJOR;
+    throw std::invalid_argument("Unknown node order: " + name);
+}
+
+template <typename Cap>
+std::vector<int> compute_node_order(const BasicGraph<Cap>& graph, NodeOrder order) {
+    std::vector<int> sequence;
+    switch (order) {
+        case NodeOrder::NONE:
+            sequence.resize(graph.size());
+            for (int u = 0; u < graph.size(); ++u) sequence[u] = u;
+            break;
+        case NodeOrder::BFS:
+            sequence = bfs_order(graph);
+            break;
+        case NodeOrder::REVERSE_CUTHILL_MCKEE:
+            sequence = rcm_order(graph);
+            break;
+        case NodeOrder::TEAM_MAJOR:
+            sequence = team_major_order(graph);
+            break;
+    }
+
+    // sequence[k] = node placed k-th; invert it into new ids
+    std::vector<int> new_id(graph.size());
+    for (int k = 0; k < graph.size(); ++k) new_id[sequence[k]] = k;
+    return new_id;
+}
+
+template <typename Cap>
+void reorder_graph(BasicGraph<Cap>& graph, NodeOrder order) {
+    if (order == NodeOrder::NONE) return;
+    graph.permute_nodes(compute_node_order(graph, order));
+}
+
+template std::vector<int> compute_node_order<int16_t>(const BasicGraph<int16_t>&, NodeOrder);
+template std::vector<int> compute_node_order<int>(const BasicGraph<int>&, NodeOrder);
+template std::vector<int> compute_node_order<long long>(const BasicGraph<long long>&, NodeOrder);
+template void reorder_graph<int16_t>(BasicGraph<int16_t>&, NodeOrder);
+template void reorder_graph<int>(BasicGraph<int>&, NodeOrder);
+template void reorder_graph<long long>(BasicGraph<long long>&, NodeOrder);
@@ -0,0 +1,122 @@
+#include "result_cache.hpp"
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <system_error>
+#include <utility>
+#include <unistd.h>
+
+namespace {
+    using u128 = unsigned __int128;
+
+    // FNV-1a 128-bit parameters
+    const u128 FNV_OFFSET = (static_cast<u128>(0x6c62272e07bb0142ULL) << 64) | 0x62b821756295c58dULL;
+    const u128 FNV_PRIME = (static_cast<u128>(0x0000000001000000ULL) << 64) | 0x000000000000013bULL;
+
+    inline void fnv_byte(u128& h, unsigned char c) {
+        h ^= c;
+        h *= FNV_PRIME;
+    }
+
+    inline bool is_space(char c) {
+        return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+    }
+
+    const char* const MAGIC = "TFC2"; // TFC1 entries held a full max flow of the whole network
+}
+
+std::string instance_key(const char* data, std::size_t size, const std::string& engine) {
+    u128 h = FNV_OFFSET;
+    bool pending_space = false; // A separator is only hashed between two tokens
+    bool any_token = false;
+    for (std::size_t k = 0; k < size; ++k) {
+        const char c = data[k];
+        if (is_space(c)) {
+            pending_space = any_token;
+            continue;
+        }
+        if (pending_space) fnv_byte(h, ' ');
+        pending_space = false;
+        any_token = true;
+        fnv_byte(h, static_cast<unsigned char>(c));
+    }
+    fnv_byte(h, 0); // Keeps "instance + engine" splits apart
+    for (char c : engine) fnv_byte(h, static_cast<unsigned char>(c));
+
+    static const char* const HEX = "0123456789abcdef";
+    std::string key(32, '0');
+    for (int k = 31; k >= 0; --k) {
+        key[k] = HEX[static_cast<unsigned>(h & 0xf)];
+        h >>= 4;
+    }
+    return key;
+}
+
+CachedResult solve_for_cache(const Tournament& t, ComponentSolver& solver) {
+    auto start = std::chrono::high_resolution_clock::now();
+    ComponentStats stats;
+
+    CachedResult result;
+    result.team1_can_win = team1_can_win(t, solver, &stats);
+    result.max_flow = stats.flow;
+    result.games_total = stats.capacity;
+    result.iterations = stats.iterations;
+    result.nodes = stats.nodes;
+    result.arcs = stats.arcs;
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+    result.runtime_ms = elapsed.count();
+    return result;
+}
+
+ResultCache::ResultCache(std::filesystem::path dir) : dir(std::move(dir)) {}
+
+std::filesystem::path ResultCache::entry_path(const std::string& key) const {
+    return dir / key.substr(0, 2) / key;
+}
+
+bool ResultCache::load(const std::string& key, CachedResult& out) const {
+    std::ifstream in(entry_path(key));
+    if (!in) return false;
+
+    std::string magic, stored_key;
+    int answer = 0;
+    CachedResult r;
+    if (!(in >> magic >> stored_key >> answer >> r.max_flow >> r.games_total >> r.iterations >> r.nodes
+             >> r.arcs >> r.runtime_ms)) {
+        return false;
+    }
+    if (magic != MAGIC || stored_key != key) return false;
+    r.team1_can_win = answer != 0;
+    out = r;
+    return true;
+}
+
+bool ResultCache::store(const std::string& key, const CachedResult& result) const {
+    const std::filesystem::path target = entry_path(key);
+    std::error_code ec;
+    std::filesystem::create_directories(target.parent_path(), ec);
+    if (ec) return false;
+
+    // Private name per process and call, renamed over the entry once complete
+    static std::atomic<unsigned> counter{0};
+    std::filesystem::path temp = target;
+    temp += ".tmp." + std::to_string(getpid()) + "." + std::to_string(counter++);
+    {
+        std::ofstream out(temp, std::ios::trunc);
+        out << MAGIC << ' ' << key << ' ' << (result.team1_can_win ? 1 : 0) << ' ' << result.max_flow << ' '
+            << result.games_total << ' ' << result.iterations << ' ' << result.nodes << ' ' << result.arcs << ' '
+            << result.runtime_ms << '\n';
+        out.close();
+        if (!out) {
+            std::filesystem::remove(temp, ec);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(temp, target, ec);
+    if (ec) {
+        std::filesystem::remove(temp, ec);
+        return false;
+    }
+    return true;
+}
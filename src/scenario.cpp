@@ -0,0 +1,240 @@
+#include "scenario.hpp"
+#include "ford_fulkerson.hpp"
+#include "warm_start.hpp"
+#include "find_path_headers/capacity_scaling.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+ScenarioExplorer::ScenarioExplorer(const Tournament& t) : n(t.n), fixtures(t.fixtures.size()) {
+    net.fromTournament(t);
+    source = net.get_source();
+    sink = net.get_sink();
+    const auto& adj = net.get_adj();
+
+    // Source arcs follow the team-1-free fixtures in order (see Graph::fromTournament)
+    fixture_of.assign(n * n, -1);
+    int next = 0;
+    for (int f = 0; f < fixtures; ++f) {
+        const Fixture& fx = t.fixtures[f];
+        fixture_of[fx.i * n + fx.j] = f;
+        source_arc.push_back(fx.i == 0 ? -1 : next++);
+        tally.push_back(fx.games);
+    }
+    tally.insert(tally.end(), t.w.begin(), t.w.end());
+
+    const int team_start = 1 + next;
+    team_node.assign(n, -1);
+    sink_arc.assign(n, -1);
+    for (int i = 1; i < n; ++i) {
+        team_node[i] = team_start + (i - 1);
+        const auto& arcs = adj[team_node[i]];
+        for (int k = 0; k < static_cast<int>(arcs.size()); ++k) {
+            if (arcs[k].to == sink && arcs[k].id >= 0) sink_arc[i] = k;
+        }
+    }
+
+    imbalance.assign(net.size(), 0);
+    parent_node.assign(net.size(), -1);
+    parent_arc.assign(net.size(), -1);
+
+    // Base solve; everything after it goes through the undo log
+    greedy_warm_start(net, source, sink);
+    FFStats stats;
+    ford_fulkerson(net, source, sink, capacity_scaling_path, AlgorithmType::CAPACITY_SCALING, &stats);
+}
+
+void ScenarioExplorer::set_tally(int slot, int value) {
+    tally_log.push_back({slot, tally[slot]});
+    tally[slot] = value;
+}
+
+void ScenarioExplorer::push(int u, int k, int amount) {
+    auto& adj = net.get_adj();
+    Edge& e = adj[u][k];
+    Edge& back = adj[e.to][e.rev];
+    arc_log.push_back({u, k, e.capacity, e.flow});
+    arc_log.push_back({e.to, e.rev, back.capacity, back.flow});
+    e.augment(amount, back);
+}
+
+// Same cancellation as repair_flow, started from one node and with every write logged.
+// The network has no flow cycles, so the walk ends at the source or the sink.
+void ScenarioExplorer::rebalance(int u, int surplus) {
+    auto& adj = net.get_adj();
+    imbalance[u] += surplus;
+    pending.assign(1, u);
+
+    while (!pending.empty()) {
+        const int x = pending.back();
+        pending.pop_back();
+        if (x == source || x == sink) {
+            imbalance[x] = 0; // The flow value changed; nothing to conserve there
+            continue;
+        }
+
+        for (int k = 0; k < static_cast<int>(adj[x].size()) && imbalance[x] != 0; ++k) {
+            const Edge& e = adj[x][k];
+            const int y = e.to;
+            int moved = 0;
+
+            if (imbalance[x] > 0 && e.flow < 0) {
+                // y -> x carries -e.flow: send part of the surplus back to y
+                moved = static_cast<int>(std::min<long long>(imbalance[x], -e.flow));
+                push(x, k, moved);
+                imbalance[x] -= moved;
+                imbalance[y] += moved;
+            } else if (imbalance[x] < 0 && e.flow > 0) {
+                // x -> y carries e.flow: pass part of the shortage on to y
+                moved = static_cast<int>(std::min<long long>(-imbalance[x], e.flow));
+                push(x, k, -moved);
+                imbalance[x] += moved;
+                imbalance[y] -= moved;
+            }
+
+            if (moved != 0) pending.push_back(y);
+        }
+    }
+}
+
+void ScenarioExplorer::set_capacity(int u, int k, int capacity) {
+    Edge& e = net.get_adj()[u][k];
+    if (e.id < 0) throw std::invalid_argument("set_capacity: not a forward arc");
+    if (capacity < 0) throw std::invalid_argument("set_capacity: negative capacity");
+    if (e.capacity == capacity) return;
+
+    arc_log.push_back({u, k, e.capacity, e.flow});
+    e.capacity = capacity;
+    if (e.flow > capacity) {
+        const int excess = e.flow - capacity;
+        const int head = e.to;
+        push(u, k, -excess);
+        rebalance(u, excess);     // u now receives more than it sends
+        rebalance(head, -excess); // and the head sends more than it receives
+    }
+}
+
+int ScenarioExplorer::max_wins_team1() const {
+    int total = tally[fixtures + 0];
+    for (int j = 1; j < n; ++j) {
+        if (fixture_of[j] != -1) total += tally[fixture_of[j]];
+    }
+    return total;
+}
+
+void ScenarioExplorer::update_sink(int team) {
+    const int slack = max_wins_team1() - tally[fixtures + team] - 1;
+    set_capacity(team_node[team], sink_arc[team], std::max(slack, 0));
+}
+
+void ScenarioExplorer::play(int i, int j, int winner) {
+    if (i > j) std::swap(i, j);
+    if (i < 0 || j >= n || i == j) throw std::invalid_argument("play: team out of range");
+    if (winner != i && winner != j) throw std::invalid_argument("play: the winner must be one of the two teams");
+    const int f = fixture_of[i * n + j];
+    if (f == -1 || tally[f] == 0) throw std::invalid_argument("play: no game left between these teams");
+
+    set_tally(f, tally[f] - 1);
+    set_tally(fixtures + winner, tally[fixtures + winner] + 1);
+    if (i > 0) set_capacity(source, source_arc[f], tally[f]);
+
+    // Team 1 winning keeps its best total; losing lowers every slack, the winner's once more
+    if (winner == 0) return;
+    if (i == 0) {
+        for (int team = 1; team < n; ++team) update_sink(team);
+    } else {
+        update_sink(winner);
+    }
+}
+
+// BFS for a shortest augmenting path, pushed with logged writes
+int ScenarioExplorer::augment() {
+    const auto& adj = net.get_adj();
+    std::fill(parent_node.begin(), parent_node.end(), -1);
+    queue.assign(1, source);
+    parent_node[source] = source;
+
+    for (size_t head = 0; head < queue.size() && parent_node[sink] == -1; ++head) {
+        const int u = queue[head];
+        for (int k = 0; k < static_cast<int>(adj[u].size()); ++k) {
+            const Edge& e = adj[u][k];
+            if (parent_node[e.to] != -1 || e.remaining_capacity() <= 0) continue;
+            parent_node[e.to] = u;
+            parent_arc[e.to] = k;
+            queue.push_back(e.to);
+        }
+    }
+    if (parent_node[sink] == -1) return 0;
+
+    int bottleneck = adj[parent_node[sink]][parent_arc[sink]].remaining_capacity();
+    for (int v = sink; v != source; v = parent_node[v]) {
+        bottleneck = std::min(bottleneck, adj[parent_node[v]][parent_arc[v]].remaining_capacity());
+    }
+    for (int v = sink; v != source; v = parent_node[v]) {
+        push(parent_node[v], parent_arc[v], bottleneck);
+    }
+    return bottleneck;
+}
+
+bool ScenarioExplorer::team1_alive() {
+    const int best = max_wins_team1();
+    for (int i = 1; i < n; ++i) {
+        if (best - tally[fixtures + i] - 1 < 0) return false;
+    }
+
+    const long long target = net.total_out_capacity(source);
+    long long flow = net.net_out_flow(source);
+    while (flow < target) {
+        const int pushed = augment();
+        if (pushed == 0) break;
+        flow += pushed;
+    }
+    return flow == target;
+}
+
+void ScenarioExplorer::checkpoint() {
+    marks.emplace_back(arc_log.size(), tally_log.size());
+}
+
+void ScenarioExplorer::rollback() {
+    std::size_t arcs_kept = 0, tallies_kept = 0;
+    if (!marks.empty()) {
+        arcs_kept = marks.back().first;
+        tallies_kept = marks.back().second;
+        marks.pop_back();
+    }
+
+    auto& adj = net.get_adj();
+    while (arc_log.size() > arcs_kept) {
+        const ArcWrite& w = arc_log.back();
+        Edge& e = adj[w.node][w.index];
+        e.capacity = w.capacity;
+        e.flow = w.flow;
+        arc_log.pop_back();
+    }
+    while (tally_log.size() > tallies_kept) {
+        tally[tally_log.back().slot] = tally_log.back().value;
+        tally_log.pop_back();
+    }
+}
+
+int ScenarioExplorer::depth() const {
+    return marks.size();
+}
+
+std::size_t ScenarioExplorer::logged_writes() const {
+    return arc_log.size() + tally_log.size();
+}
+
+int ScenarioExplorer::wins(int team) const {
+    return tally[fixtures + team];
+}
+
+int ScenarioExplorer::games_left(int i, int j) const {
+    if (i > j) std::swap(i, j);
+    const int f = fixture_of[i * n + j];
+    return f == -1 ? 0 : tally[f];
+}
+
+const Graph& ScenarioExplorer::graph() const {
+    return net;
+}
@@ -0,0 +1,151 @@
+#include "sensitivity.hpp"
+#include "graph.hpp"
+#include "ford_fulkerson.hpp"
+#include "warm_start.hpp"
+#include "find_path_headers/capacity_scaling.hpp"
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+    // Strongly connected components of the residual graph (arcs with remaining capacity),
+    // by an iterative Tarjan. Components are numbered in the order Tarjan closes them, which
+    // is a reverse topological order of the condensation: every residual arc leaving a
+    // component leads to one with a smaller number.
+    int residual_components(const Graph& graph, std::vector<int>& comp) {
+        const int n = graph.size();
+        std::vector<int> index(n, -1), low(n, 0), stack, frames, next_arc(n, 0);
+        std::vector<char> on_stack(n, 0);
+        comp.assign(n, -1);
+        int counter = 0, components = 0;
+
+        for (int root = 0; root < n; ++root) {
+            if (index[root] != -1) continue;
+            frames.push_back(root);
+            index[root] = low[root] = counter++;
+            stack.push_back(root);
+            on_stack[root] = 1;
+
+            while (!frames.empty()) {
+                const int u = frames.back();
+                const auto& arcs = graph.adj(u);
+                if (next_arc[u] < static_cast<int>(arcs.size())) {
+                    const auto& e = arcs[next_arc[u]++];
+                    if (e.remaining_capacity() <= 0) continue;
+                    const int v = e.to;
+                    if (index[v] == -1) {
+                        index[v] = low[v] = counter++;
+                        stack.push_back(v);
+                        on_stack[v] = 1;
+                        frames.push_back(v);
+                    } else if (on_stack[v]) {
+                        low[u] = std::min(low[u], index[v]);
+                    }
+                    continue;
+                }
+
+                // u is done: close its component if it is a root, then report to the parent
+                frames.pop_back();
+                if (low[u] == index[u]) {
+                    int v;
+                    do {
+                        v = stack.back();
+                        stack.pop_back();
+                        on_stack[v] = 0;
+                        comp[v] = components;
+                    } while (v != u);
+                    ++components;
+                }
+                if (!frames.empty()) low[frames.back()] = std::min(low[frames.back()], low[u]);
+            }
+        }
+        return components;
+    }
+}
+
+SensitivityReport critical_games(const Tournament& t) {
+    SensitivityReport report;
+    Graph graph;
+    graph.fromTournament(t);
+    const int s = graph.get_source();
+    const int sink = graph.get_sink();
+    const int n = graph.size();
+
+    greedy_warm_start(graph, s, sink);
+    FFStats stats;
+    report.max_flow = ford_fulkerson(graph, s, sink, capacity_scaling_path, AlgorithmType::CAPACITY_SCALING, &stats);
+    report.games_total = graph.total_out_capacity(s);
+    report.team1_can_win = !graph.get_cant_be_champion() && report.max_flow == report.games_total;
+
+    // Nodes reachable from s in the residual graph: the source side of every min cut
+    std::vector<char> from_source(n, 0);
+    std::vector<int> queue{s};
+    from_source[s] = 1;
+    for (size_t head = 0; head < queue.size(); ++head) {
+        for (const auto& e : graph.adj(queue[head])) {
+            if (e.remaining_capacity() > 0 && !from_source[e.to]) {
+                from_source[e.to] = 1;
+                queue.push_back(e.to);
+            }
+        }
+    }
+
+    // Bit 0 = t, bit i = team i: what each component reaches, built up in closing order
+    std::vector<int> comp;
+    const int components = residual_components(graph, comp);
+    const int words = (t.n + 63) / 64;
+    std::vector<std::uint64_t> reach(static_cast<size_t>(components) * words, 0);
+    auto bits = [&](int c) { return &reach[static_cast<size_t>(c) * words]; };
+    auto has = [&](int c, int bit) { return (bits(c)[bit / 64] >> (bit % 64)) & 1; };
+
+    const int game_start = 1;
+    int game_nodes = 0;
+    for (const Fixture& f : t.fixtures) game_nodes += f.i > 0;
+    const int team_start = game_start + game_nodes;
+    auto team_of = [&](int u) { return u == sink ? 0 : (u >= team_start && u < sink ? u - team_start + 1 : -1); };
+
+    std::vector<std::vector<int>> members(components);
+    for (int u = 0; u < n; ++u) members[comp[u]].push_back(u);
+    for (int c = 0; c < components; ++c) {
+        std::uint64_t* own = bits(c);
+        for (int u : members[c]) {
+            if (team_of(u) != -1) own[team_of(u) / 64] |= std::uint64_t(1) << (team_of(u) % 64);
+            for (const auto& e : graph.adj(u)) {
+                if (e.remaining_capacity() <= 0 || comp[e.to] == c) continue;
+                const std::uint64_t* other = bits(comp[e.to]);
+                for (int w = 0; w < words; ++w) own[w] |= other[w];
+            }
+        }
+    }
+
+    auto membership = [&](int u, const Edge& e) {
+        if (e.remaining_capacity() > 0) return CutMembership::NONE;
+        if (from_source[u] && has(comp[e.to], 0)) return CutMembership::EVERY;
+        return comp[u] != comp[e.to] ? CutMembership::SOME : CutMembership::NONE;
+    };
+
+    report.team_cut.assign(t.n, CutMembership::NONE);
+    for (int i = 1; i < t.n; ++i) {
+        const int u = team_start + i - 1;
+        for (const auto& e : graph.adj(u)) {
+            if (e.to == sink && e.id >= 0) report.team_cut[i] = membership(u, e);
+        }
+    }
+
+    // Source arcs follow the team-1-free fixtures in order (see Graph::fromTournament)
+    int k = 0;
+    for (const Fixture& f : t.fixtures) {
+        if (f.i == 0) continue;
+        const auto& e = graph.adj(s)[k++];
+        GameSensitivity game{f.i, f.j, f.games, membership(s, e), false, false};
+
+        // i winning eliminates team 1 iff neither j nor t is reachable from i
+        if (report.team1_can_win) {
+            const int ci = comp[team_start + f.i - 1];
+            const int cj = comp[team_start + f.j - 1];
+            game.flips_if_i_wins = !has(ci, 0) && !has(ci, f.j);
+            game.flips_if_j_wins = !has(cj, 0) && !has(cj, f.i);
+        }
+        report.games.push_back(game);
+    }
+    return report;
+}
@@ -0,0 +1,174 @@
+#include "simulation.hpp"
+#include "generator.hpp"
+#include "graph.hpp"
+#include "ford_fulkerson.hpp"
+#include "warm_start.hpp"
+#include "thread_pool.hpp"
+#include "find_path_headers/capacity_scaling.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+WinModel even_win_model(const Tournament& t, double bias) {
+    WinModel model;
+    for (const Fixture& f : t.fixtures) {
+        model.p.push_back(f.i == 0 ? std::clamp(0.5 + bias, 0.0, 1.0) : 0.5);
+    }
+    return model;
+}
+
+WinModel random_win_model(const Tournament& t, double bias, std::uint64_t seed) {
+    std::mt19937_64 rng = seeded_rng(seed, 0);
+    WinModel model;
+    for (const Fixture& f : t.fixtures) {
+        model.p.push_back(std::clamp(unit_random(rng) + (f.i == 0 ? bias : 0.0), 0.0, 1.0));
+    }
+    return model;
+}
+
+void wilson_interval(long long successes, long long trials, double z, double& low, double& high) {
+    if (trials <= 0) {
+        low = 0.0;
+        high = 1.0;
+        return;
+    }
+    const double n = static_cast<double>(trials);
+    const double p = successes / n;
+    const double z2 = z * z;
+    const double center = (p + z2 / (2 * n)) / (1 + z2 / n);
+    const double half = z * std::sqrt(p * (1 - p) / n + z2 / (4 * n * n)) / (1 + z2 / n);
+    low = std::max(0.0, center - half);
+    high = std::min(1.0, center + half);
+}
+
+namespace {
+    // One thread's share of the samples, on its own network and generator
+    struct SampleWorker {
+        const Tournament& base;
+        const WinModel& model;
+        std::mt19937_64 rng;
+
+        Graph graph;
+        int source;
+        int sink;
+        std::vector<int> source_arc;  // Index in adj[source] of each fixture's arc (-1 for team 1's games)
+        std::vector<int> team_node;   // Node of team i >= 1
+        std::vector<int> sink_arc;    // Index in adj[team_node[i]] of its arc into the sink
+
+        std::vector<int> slots;       // One entry per remaining game: its fixture
+        std::vector<int> remaining;   // Games left per fixture in the current sample
+        std::vector<int> wins;
+        bool carry_flow;              // Start each solve from the previous sample's flow
+        FFStats stats;
+
+        SampleWorker(const Tournament& t, const WinModel& model, std::uint64_t seed, int stream, int played)
+            : base(t), model(model), rng(seeded_rng(seed, stream)) {
+            graph.fromTournament(t);
+            source = graph.get_source();
+            sink = graph.get_sink();
+            const auto& adj = graph.get_adj();
+
+            // Source arcs follow the team-1-free fixtures in order (see Graph::fromTournament)
+            int next = 0;
+            for (const Fixture& f : t.fixtures) source_arc.push_back(f.i == 0 ? -1 : next++);
+
+            const int team_start = 1 + next;
+            team_node.assign(t.n, -1);
+            sink_arc.assign(t.n, -1);
+            for (int i = 1; i < t.n; ++i) {
+                team_node[i] = team_start + (i - 1);
+                const auto& arcs = adj[team_node[i]];
+                for (int k = 0; k < static_cast<int>(arcs.size()); ++k) {
+                    if (arcs[k].to == sink && arcs[k].id >= 0) sink_arc[i] = k;
+                }
+            }
+
+            for (int f = 0; f < static_cast<int>(t.fixtures.size()); ++f) {
+                slots.insert(slots.end(), t.fixtures[f].games, f);
+            }
+
+            // Consecutive samples differ in at most 2 * played games. When that is a small
+            // part of the network, repairing the last flow leaves less to do than the greedy
+            // start from zero; otherwise the repaired flow is a worse start than the greedy one.
+            carry_flow = static_cast<long long>(played) * 16 <= next;
+        }
+
+        // Plays `played` random remaining games; returns true if team 1 can still finish first
+        bool sample(int played, long long& flow_solves) {
+            remaining.resize(base.fixtures.size());
+            for (size_t f = 0; f < remaining.size(); ++f) remaining[f] = base.fixtures[f].games;
+            wins = base.w;
+
+            // Partial Fisher-Yates, continued from the last sample's permutation (still uniform)
+            const int total = slots.size();
+            for (int k = 0; k < played; ++k) {
+                std::swap(slots[k], slots[k + bounded_random(rng, total - k)]);
+                const int f = slots[k];
+                const Fixture& fixture = base.fixtures[f];
+                --remaining[f];
+                ++wins[unit_random(rng) < model.p[f] ? fixture.i : fixture.j];
+            }
+
+            int max_wins = wins[0];
+            for (size_t f = 0; f < remaining.size(); ++f) {
+                if (base.fixtures[f].i == 0) max_wins += remaining[f];
+            }
+            for (int i = 1; i < base.n; ++i) {
+                if (max_wins - wins[i] - 1 < 0) return false;
+            }
+
+            // Same network, new capacities: games left on the source arcs, slacks on the sink arcs
+            auto& adj = graph.get_adj();
+            for (size_t f = 0; f < remaining.size(); ++f) {
+                if (source_arc[f] != -1) adj[source][source_arc[f]].capacity = remaining[f];
+            }
+            for (int i = 1; i < base.n; ++i) {
+                adj[team_node[i]][sink_arc[i]].capacity = max_wins - wins[i] - 1;
+            }
+
+            ++flow_solves;
+            if (carry_flow) {
+                repair_flow(graph, source, sink);
+            } else {
+                graph.reset_flow();
+            }
+            greedy_warm_start(graph, source, sink);
+            stats.clear();
+            return ford_fulkerson_saturates(graph, source, sink, capacity_scaling_path,
+                                            AlgorithmType::CAPACITY_SCALING, &stats);
+        }
+    };
+}
+
+SimulationResult simulate_championship(const Tournament& t, const WinModel& model, double alpha,
+                                       long long samples, int threads, std::uint64_t seed, double z) {
+    long long total_games = 0;
+    for (const Fixture& f : t.fixtures) total_games += f.games;
+    const int played = static_cast<int>(std::min<double>(total_games, std::ceil(alpha * total_games)));
+
+    ThreadPool pool(threads > 0 ? threads : ThreadPool::default_threads());
+    const int workers = pool.size();
+    std::atomic<long long> alive{0};
+    std::atomic<long long> flow_solves{0};
+
+    pool.run([&](int tid) {
+        long long share = samples / workers + (tid < samples % workers ? 1 : 0);
+        if (share == 0) return;
+
+        SampleWorker worker(t, model, seed, tid, played);
+        long long local_alive = 0, local_solves = 0;
+        for (long long k = 0; k < share; ++k) {
+            if (worker.sample(played, local_solves)) ++local_alive;
+        }
+        alive += local_alive;
+        flow_solves += local_solves;
+    });
+
+    SimulationResult result;
+    result.samples = samples;
+    result.alive = alive.load();
+    result.flow_solves = flow_solves.load();
+    result.probability = samples > 0 ? static_cast<double>(result.alive) / samples : 0.0;
+    wilson_interval(result.alive, samples, z, result.ci_low, result.ci_high);
+    return result;
+}
@@ -0,0 +1,82 @@
+#include "stream_server.hpp"
+#include "arena.hpp"
+#include "capacity_width.hpp"
+#include "components.hpp"
+#include "dinics.hpp"
+#include "graph.hpp"
+#include "tournament.hpp"
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    // Max flow of one DIMACS block; the graph lives in `arena`, which is released afterwards
+    // (also when read_dimacs throws, so the next width starts from an empty arena)
+    template <typename Cap>
+    long long dimacs_max_flow(const std::string& text, Arena& arena, NodeOrder node_order) {
+        long long flow;
+        try {
+            BasicGraph<Cap> graph(0, &arena);
+            std::istringstream in(text);
+            graph.read_dimacs(in);
+            reorder_graph(graph, node_order);
+            flow = dinic_max_flow(graph, graph.get_source(), graph.get_sink());
+        } catch (...) {
+            arena.release();
+            throw;
+        }
+        arena.release();
+        return flow;
+    }
+
+    long long dimacs_max_flow(const std::string& text, Arena& arena, NodeOrder node_order) {
+        return with_narrowest_width([&](auto cap) {
+            return dimacs_max_flow<decltype(cap)>(text, arena, node_order);
+        });
+    }
+}
+
+long long serve_stream(std::istream& in, std::ostream& out, int threads, NodeOrder node_order,
+                       DecisionEngine engine, const EngineModel& model, bool warm_start) {
+    ComponentSolver solver(threads, node_order, engine, model, warm_start);
+    Arena dimacs_arena;
+    Tournament tournament;
+    std::string block;
+    long long answered = 0;
+
+    while (in >> std::ws && in.peek() != std::char_traits<char>::eof()) {
+        if (in.peek() == 'd') {
+            std::string keyword;
+            long long bytes = -1;
+            if (!(in >> keyword >> bytes) || keyword != "dimacs" || bytes < 0) {
+                out << "erro: cabeçalho inválido\n" << std::flush;
+                return answered + 1; // The stream can no longer be split into instances
+            }
+            in.get(); // End of the header line
+            block.resize(bytes);
+            in.read(&block[0], bytes);
+            if (in.gcount() != bytes) {
+                out << "erro: bloco incompleto\n" << std::flush;
+                return answered + 1;
+            }
+
+            try {
+                out << dimacs_max_flow(block, dimacs_arena, node_order) << '\n';
+            } catch (const std::exception& e) {
+                dimacs_arena.release();
+                out << "erro: " << e.what() << '\n';
+            }
+        } else {
+            if (!read_tournament(in, tournament) || tournament.n < 2) {
+                out << "erro: torneio incompleto\n" << std::flush;
+                return answered + 1;
+            }
+            out << (team1_can_win(tournament, solver) ? "sim" : "não") << '\n';
+        }
+
+        out.flush();
+        ++answered;
+    }
+
+    return answered;
+}
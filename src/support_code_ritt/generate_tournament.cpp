@@ -3,6 +3,7 @@
 #include <random>
 #include <cstdlib>
 #include <cmath>
+#include <string>
 
 using namespace std;
 
@@ -12,6 +13,7 @@ int main(int argc, char* argv[]) {
     int c = (argc > 2) ? atoi(argv[2]) : 2;
     double α = (argc > 3) ? atof(argv[3]) : 0.5;
     double β = (argc > 4) ? atof(argv[4]) : 0.1;
+    bool sparse = argc > 5 && string(argv[5]) == "--sparse"; // only the pairs with games left
 
     if (n <= 0 || c <= 0  || α < 0.0 || α > 1.0 || β < -1.0 || β > 1.0) {
         cerr << "Invalid arguments. Ensure n > 0, c > 0, and 0 ≤ α ≤ 1, and -1 ≤ β ≤ 1.\n";
@@ -48,6 +50,23 @@ int main(int argc, char* argv[]) {
         w[k] += 1;
     }
 
+    if (sparse) {
+        int F = 0;
+        for (int i = 0; i + 1 < n; ++i)
+            for (int j = i + 1; j < n; ++j)
+                F += G[i][j] > 0;
+
+        cout << "S " << n << endl;
+        for(auto e : w)
+            cout << e << " ";
+        cout << endl << F << endl;
+        for (int i = 0; i + 1 < n; ++i)
+            for (int j = i + 1; j < n; ++j)
+                if (G[i][j] > 0)
+                    cout << i + 1 << " " << j + 1 << " " << G[i][j] << "\n";
+        return 0;
+    }
+
     cout << n << endl;
     for(auto e : w)
         cout << e << " ";
@@ -12,7 +12,7 @@
 namespace fs = std::filesystem;
 
 const std::string DATASET_DIR = "dataset1";
-const std::string EXECUTABLE = "./bin/tournament_timer";
+const std::string EXECUTABLE = "./bin/tournament_timer"; // Baseline solve; --pipeline would time the decision pipeline
 const std::string OUTPUT_CSV = "execution_times.csv";
 
 double run_and_get_time(const std::string& instance_path) {
@@ -12,9 +12,12 @@
 
 namespace fs = std::filesystem;
 
-int main() {
+// Uso: ./bin/test_win_percentage [DIR_CACHE]
+// Com um diretório de cache, instâncias já resolvidas não são resolvidas de novo
+int main(int argc, char* argv[]) {
     const std::string dataset_dir = "dataset2";
-    const std::string binary_path = "./bin/tournament";
+    std::string binary_path = "./bin/tournament";
+    if (argc > 1) binary_path += std::string(" --cache ") + argv[1];
     const std::string output_csv = "dataset2_summary.csv";
 
     std::ofstream csv(output_csv);
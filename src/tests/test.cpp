@@ -2,30 +2,83 @@
 #include "ford_fulkerson.hpp"
 #include "dinics.hpp"
 #include "find_path_headers/bfs.hpp"
+#include "find_path_headers/bfs_hybrid.hpp"
+#include "find_path_headers/bfs_parallel.hpp"
+#include "push_relabel.hpp"
+#include "reorder.hpp"
+#include "arena.hpp"
+#include "capacity_width.hpp"
 #include "find_path_headers/dfs_random.hpp"
 #include "find_path_headers/fattest.hpp"
 #include "find_path_headers/capacity_scaling.hpp"
+#include "trace_writer.hpp"
 
 
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <sstream>
 #include <string>
 
+// Engines available for every capacity type: bfs and scaling (Ford-Fulkerson) and queue Dinic
+static bool is_templated_engine(const std::string& name) {
+    return name == "bfs" || name == "scaling" || name == "dinics";
+}
+
+// Reads the instance into a graph with capacity type Cap and runs a templated engine
+template <typename Cap>
+long long run_templated(const std::string& input, const std::string& name, NodeOrder node_order, FFStats& stats) {
+    Arena arena;
+    BasicGraph<Cap> graph(0, &arena);
+    std::istringstream in(input);
+    graph.read_dimacs(in);
+    reorder_graph(graph, node_order);
+
+    int source = graph.get_source();
+    int sink = graph.get_sink();
+    if (name == "dinics") return dinic_max_flow(graph, source, sink);
+    if (name == "bfs") return ford_fulkerson(graph, source, sink, bfs_path<Cap>, AlgorithmType::BFS_EDMONDS_KARP, &stats);
+    return ford_fulkerson(graph, source, sink, capacity_scaling_path<Cap>, AlgorithmType::CAPACITY_SCALING, &stats);
+}
+
 int main(int argc, char* argv[]) {
     bool is_ford_fulkerson = true;
+    LevelBfs level_bfs = LevelBfs::QUEUE;
+    bool is_push_relabel = false;
+    int threads = 0;
+    NodeOrder node_order = NodeOrder::NONE;
     bool is_cout_csv = false;
+    std::string trace_path; // Empty = no trace
+
+    // "--trace FILE" may appear anywhere; the remaining arguments are positional
+    int positional = 1;
+    for (int a = 1; a < argc; ++a) {
+        if (std::string(argv[a]) == "--trace" && a + 1 < argc) {
+            trace_path = argv[++a];
+        } else {
+            argv[positional++] = argv[a];
+        }
+    }
+    argc = positional;
 
     if (argc < 2) {
-        std::cerr << "Uso: " << argv[0] << " bfs|dfs|fat|scaling|dinics < dimacs_graph\n";
+        std::cerr << "Uso: " << argv[0] << " bfs|bfs-hybrid|bfs-parallel|dfs|fat|scaling|dinics|dinics-hybrid|dinics-parallel|push-relabel [threads] [none|bfs|rcm|team] [--trace arquivo.json] < dimacs_graph\n";
         return 1;
     }
 
     std::string strategy_name = argv[1];
     PathFindingStrategy strategy = nullptr;
-    AlgorithmType type;
+    AlgorithmType type = AlgorithmType::BFS_EDMONDS_KARP; // Only read by the Ford-Fulkerson strategies
 
     if (strategy_name == "bfs") {
         strategy = bfs_path;
         type = AlgorithmType::BFS_EDMONDS_KARP;
+    } else if (strategy_name == "bfs-hybrid") {
+        strategy = bfs_hybrid_path;
+        type = AlgorithmType::BFS_EDMONDS_KARP;
+    } else if (strategy_name == "bfs-parallel") {
+        strategy = bfs_parallel_path;
+        type = AlgorithmType::BFS_EDMONDS_KARP;
     } else if (strategy_name == "dfs") {
         strategy = dfs_path;
         type = AlgorithmType::DFS_RANDOM;
@@ -39,25 +92,76 @@ int main(int argc, char* argv[]) {
         is_ford_fulkerson = false;
         //strategy = dinics_path;
         //std::cerr << "Ainda não implementado dinics\n";
+    } else if (strategy_name == "dinics-hybrid") {
+        is_ford_fulkerson = false;
+        level_bfs = LevelBfs::DIRECTION_OPTIMIZING;
+    } else if (strategy_name == "push-relabel") {
+        is_ford_fulkerson = false;
+        is_push_relabel = true;
+        type = AlgorithmType::PARALLEL_PUSH_RELABEL;
+    } else if (strategy_name == "dinics-parallel") {
+        is_ford_fulkerson = false;
+        level_bfs = LevelBfs::PARALLEL;
     } else {
         std::cerr << "Estrategia inválida: " << strategy_name << ". Use bfs ou dfs.\n";
         return 1;
     }
 
-    Graph graph;
-    graph.read_dimacs(std::cin);
-
+    // Optional thread count for the parallel engines (0 = all hardware threads)
+    if (argc > 2) {
+        threads = std::stoi(argv[2]);
+        set_bfs_threads(threads);
+    }
+    // Optional node renumbering applied after reading
+    if (argc > 3) {
+        node_order = parse_node_order(argv[3]);
+    }
 
-    int source = graph.get_source();
-    int sink = graph.get_sink();
-    int max_flow = -3;
+    // Kept in memory: an instance too wide for its capacity type is read again one width up
+    std::string input((std::istreambuf_iterator<char>(std::cin)), std::istreambuf_iterator<char>());
 
+    long long max_flow = -3;
     FFStats stats;
 
-    if(is_ford_fulkerson){
-        max_flow = ford_fulkerson(graph, source, sink, strategy, type, &stats);
-    }else{ 
-        max_flow = dinic_max_flow(graph, source, sink);
+    // Ford-Fulkerson augmentations streamed as Chrome trace events (chrome://tracing, Perfetto)
+    std::unique_ptr<TraceWriter> trace;
+    if (!trace_path.empty()) {
+        trace = std::make_unique<TraceWriter>(trace_path);
+        if (!trace->is_open()) {
+            std::cerr << "Não foi possível abrir " << trace_path << "\n";
+            return 1;
+        }
+        stats.trace = trace.get();
+    }
+
+    if (is_templated_engine(strategy_name)) {
+        // Capacity type picked from the instance: 16-bit arcs when they fit, 64-bit when int overflows
+        max_flow = with_narrowest_width([&](auto cap) {
+            return run_templated<decltype(cap)>(input, strategy_name, node_order, stats);
+        });
+    } else {
+        // Adjacency lists live in one huge-page backed region, freed at exit
+        Arena arena;
+        Graph graph(0, &arena);
+        std::istringstream in(input);
+        try {
+            graph.read_dimacs(in);
+        } catch (const std::overflow_error&) {
+            std::cerr << "Capacidades excedem int: use bfs, scaling ou dinics.\n";
+            return 1;
+        }
+        reorder_graph(graph, node_order);
+
+        int source = graph.get_source();
+        int sink = graph.get_sink();
+
+        if(is_ford_fulkerson){
+            max_flow = ford_fulkerson(graph, source, sink, strategy, type, &stats);
+        }else if(is_push_relabel){
+            max_flow = parallel_push_relabel(graph, source, sink, threads, &stats);
+        }else{ 
+            max_flow = dinic_max_flow(graph, source, sink, level_bfs);
+        }
     }
 
     if(is_cout_csv){
@@ -73,6 +177,11 @@ int main(int argc, char* argv[]) {
         std::cout << "iterations:" << stats.iterations << "\n";
         std::cout << "bound:" << stats.bound << "\n";
         std::cout << "r (iterations/max_iterations):" << stats.r << "\n";    
+
+        for (size_t i = 0; i < stats.pushes_per_thread.size(); ++i) {
+            std::cout << "thread " << i << ": pushes=" << stats.pushes_per_thread[i]
+                      << " relabels=" << stats.relabels_per_thread[i] << "\n";
+        }
     }
    
 
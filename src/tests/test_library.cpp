@@ -0,0 +1,57 @@
+#include "tournamentflow.hpp"
+
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+// Drives libtournamentflow through its public header only, as an embedding program would:
+//   dimacs      solves the instance once with every FlowEngine on the same handle
+//   tournament  the sim/não decision and the max flow of team 1's network
+int main(int argc, char* argv[]) {
+    const std::string kind = argc > 1 ? argv[1] : "";
+    if (kind != "dimacs" && kind != "tournament") {
+        std::cerr << "Uso: " << argv[0] << " dimacs|tournament [threads] < instância\n";
+        return 1;
+    }
+    const int threads = argc > 2 ? std::stoi(argv[2]) : 0;
+
+    const std::string input((std::istreambuf_iterator<char>(std::cin)), std::istreambuf_iterator<char>());
+    FlowSolver solver(threads);
+
+    try {
+        if (kind == "tournament") {
+            solver.load_tournament(input.data(), input.size());
+            std::cout << (solver.team1_can_win() ? "sim" : "não") << "\n";
+            std::cout << "max flow:" << solver.solve(FlowEngine::DINIC) << "\n";
+            return 0;
+        }
+        solver.load_dimacs(input.data(), input.size());
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "erro: " << e.what() << "\n";
+        return 1;
+    }
+
+    const struct {
+        FlowEngine engine;
+        const char* name;
+    } engines[] = {
+        {FlowEngine::EDMONDS_KARP, "edmonds_karp"},
+        {FlowEngine::CAPACITY_SCALING, "capacity_scaling"},
+        {FlowEngine::DINIC, "dinic"},
+        {FlowEngine::PUSH_RELABEL, "push_relabel"},
+        {FlowEngine::EDMONDS_KARP_HYBRID, "edmonds_karp_hybrid"},
+        {FlowEngine::DINIC_HYBRID, "dinic_hybrid"},
+        {FlowEngine::EDMONDS_KARP_PARALLEL, "edmonds_karp_parallel"},
+        {FlowEngine::DINIC_PARALLEL, "dinic_parallel"},
+    };
+    for (const auto& e : engines) {
+        std::cout << e.name << ": ";
+        try {
+            std::cout << solver.solve(e.engine) << "\n";
+        } catch (const std::logic_error&) {
+            std::cout << "só int\n"; // Engine limited to int networks, instance built with 64-bit arcs
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,68 @@
+#include "thread_pool.hpp"
+#include <algorithm>
+
+ThreadPool::ThreadPool(int threads) : threads(std::max(1, threads)) {
+    for (int tid = 1; tid < this->threads; ++tid) {
+        workers.emplace_back(&ThreadPool::worker_loop, this, tid);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    start_cv.notify_all();
+    for (std::thread& w : workers) w.join();
+}
+
+int ThreadPool::size() const {
+    return threads;
+}
+
+int ThreadPool::default_threads() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+void ThreadPool::run(const std::function<void(int)>& fn) {
+    if (threads == 1) {
+        fn(0);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = &fn;
+        pending = threads - 1;
+        ++generation;
+    }
+    start_cv.notify_all();
+
+    fn(0); // The caller is thread 0
+
+    std::unique_lock<std::mutex> lock(mutex);
+    done_cv.wait(lock, [&] { return pending == 0; });
+    job = nullptr;
+}
+
+void ThreadPool::worker_loop(int tid) {
+    unsigned long long seen = 0;
+    while (true) {
+        const std::function<void(int)>* current;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            start_cv.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+            current = job;
+        }
+
+        (*current)(tid);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            --pending;
+        }
+        done_cv.notify_one();
+    }
+}
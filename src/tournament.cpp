@@ -0,0 +1,192 @@
+#include "tournament.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+int Tournament::remaining_games(int team) const {
+    int total = 0;
+    for (const Fixture& f : fixtures) {
+        if (f.i == team || f.j == team) total += f.games;
+    }
+    return total;
+}
+
+int Tournament::max_wins_team1() const {
+    return w[0] + remaining_games(0);
+}
+
+std::vector<int> Tournament::slack() const {
+    int maxW1 = max_wins_team1();
+    std::vector<int> m(n, 0);
+    for (int i = 1; i < n; ++i) {
+        m[i] = maxW1 - w[i] - 1;
+    }
+    return m;
+}
+
+void Tournament::sort_fixtures() {
+    auto before = [](const Fixture& a, const Fixture& b) { return a.i != b.i ? a.i < b.i : a.j < b.j; };
+    if (std::adjacent_find(fixtures.begin(), fixtures.end(), [&](const Fixture& a, const Fixture& b) {
+            return !before(a, b);
+        }) == fixtures.end()) {
+        return; // Strictly increasing already
+    }
+
+    std::sort(fixtures.begin(), fixtures.end(), before);
+    size_t kept = 0;
+    for (size_t k = 0; k < fixtures.size(); ++k) {
+        if (kept > 0 && fixtures[kept - 1].i == fixtures[k].i && fixtures[kept - 1].j == fixtures[k].j) {
+            fixtures[kept - 1].games += fixtures[k].games;
+        } else {
+            fixtures[kept++] = fixtures[k];
+        }
+    }
+    fixtures.resize(kept);
+}
+
+Tournament read_tournament(std::istream& in) {
+    Tournament t;
+    if (!read_tournament(in, t) || t.n < 2) {
+        throw std::runtime_error("Incomplete or invalid tournament");
+    }
+    return t;
+}
+
+namespace {
+    bool read_tournament_dense(std::istream& in, Tournament& t) {
+        t.n = 0;
+        if (!(in >> t.n) || t.n < 0) return false;
+
+        // current wins for each team
+        t.w.assign(t.n, 0);
+        for (int i = 0; i < t.n; ++i) in >> t.w[i];
+
+        // remaining games matrix (upper triangular), kept only where games > 0
+        t.fixtures.clear();
+        for (int i = 0; i < t.n; ++i)
+            for (int j = i + 1; j < t.n; ++j) {
+                int games;
+                in >> games;
+                if (games > 0) t.fixtures.push_back({i, j, games});
+            }
+
+        return static_cast<bool>(in);
+    }
+}
+
+bool read_tournament(std::istream& in, Tournament& t) {
+    in >> std::ws;
+    switch (in.peek()) {
+        case 'S': return read_tournament_sparse(in, t);
+        case 'T': return read_tournament_binary(in, t);
+        default:  return read_tournament_dense(in, t);
+    }
+}
+
+bool read_tournament_sparse(std::istream& in, Tournament& t) {
+    char tag = 0;
+    int fixtures = 0;
+    t.n = 0;
+    if (!(in >> tag) || tag != 'S' || !(in >> t.n) || t.n < 0) return false;
+
+    t.w.resize(t.n);
+    for (int i = 0; i < t.n; ++i) {
+        if (!(in >> t.w[i])) return false;
+    }
+    if (!(in >> fixtures) || fixtures < 0) return false;
+
+    t.fixtures.clear();
+    for (int k = 0; k < fixtures; ++k) {
+        Fixture f;
+        if (!(in >> f.i >> f.j >> f.games)) return false;
+        if (f.i > f.j) std::swap(f.i, f.j);
+        --f.i;
+        --f.j;
+        if (f.i < 0 || f.i == f.j || f.j >= t.n || f.games < 0) return false;
+        if (f.games > 0) t.fixtures.push_back(f);
+    }
+
+    // The rest of the code expects fixtures in (i, j) order, one per pair
+    t.sort_fixtures();
+    return true;
+}
+
+void write_tournament_sparse(std::ostream& out, const Tournament& t) {
+    out << "S " << t.n << '\n';
+    for (int i = 0; i < t.n; ++i) out << t.w[i] << ' ';
+    out << '\n' << t.fixtures.size() << '\n';
+    for (const Fixture& f : t.fixtures) {
+        out << f.i + 1 << ' ' << f.j + 1 << ' ' << f.games << '\n';
+    }
+}
+
+void write_tournament(std::ostream& out, const Tournament& t) {
+    out << t.n << '\n';
+    for (int i = 0; i < t.n; ++i) out << t.w[i] << ' ';
+    out << '\n';
+
+    // fixtures are sorted by (i, j), so one pass fills the gaps with zeros
+    size_t next = 0;
+    for (int i = 0; i + 1 < t.n; ++i) {
+        for (int j = i + 1; j < t.n; ++j) {
+            int games = 0;
+            if (next < t.fixtures.size() && t.fixtures[next].i == i && t.fixtures[next].j == j) {
+                games = t.fixtures[next++].games;
+            }
+            out << games << ' ';
+        }
+        out << '\n';
+    }
+}
+
+namespace {
+    const char BINARY_MAGIC[4] = {'T', 'F', 'B', '1'};
+
+    void put_int(std::ostream& out, int value) {
+        int32_t v = value;
+        out.write(reinterpret_cast<const char*>(&v), sizeof(v));
+    }
+
+    bool get_int(std::istream& in, int& value) {
+        int32_t v;
+        if (!in.read(reinterpret_cast<char*>(&v), sizeof(v))) return false;
+        value = v;
+        return true;
+    }
+}
+
+void write_tournament_binary(std::ostream& out, const Tournament& t) {
+    out.write(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+    put_int(out, t.n);
+    for (int i = 0; i < t.n; ++i) put_int(out, t.w[i]);
+    put_int(out, static_cast<int>(t.fixtures.size()));
+    for (const Fixture& f : t.fixtures) {
+        put_int(out, f.i);
+        put_int(out, f.j);
+        put_int(out, f.games);
+    }
+}
+
+bool read_tournament_binary(std::istream& in, Tournament& t) {
+    char magic[sizeof(BINARY_MAGIC)];
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, BINARY_MAGIC, sizeof(magic)) != 0) return false;
+
+    int fixtures;
+    if (!get_int(in, t.n) || t.n < 0) return false;
+    t.w.resize(t.n);
+    for (int i = 0; i < t.n; ++i) {
+        if (!get_int(in, t.w[i])) return false;
+    }
+    if (!get_int(in, fixtures) || fixtures < 0) return false;
+
+    t.fixtures.resize(fixtures);
+    for (Fixture& f : t.fixtures) {
+        if (!get_int(in, f.i) || !get_int(in, f.j) || !get_int(in, f.games)) return false;
+        if (f.i < 0 || f.i >= f.j || f.j >= t.n || f.games <= 0) return false;
+    }
+
+    // Written in (i, j) order by write_tournament_binary, but other writers may not be
+    t.sort_fixtures();
+    return true;
+}
@@ -0,0 +1,294 @@
+#include "tournamentflow.hpp"
+#include "capacity_width.hpp"
+#include "dinics.hpp"
+#include "push_relabel.hpp"
+#include "find_path_headers/bfs.hpp"
+#include "find_path_headers/bfs_hybrid.hpp"
+#include "find_path_headers/bfs_parallel.hpp"
+#include "find_path_headers/capacity_scaling.hpp"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+namespace {
+    // Whitespace-separated tokens read straight from a memory buffer (no copies, no streams)
+    struct TextCursor {
+        const char* p;
+        const char* end;
+
+        static bool is_space(char c) {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+        }
+
+        void skip_space() {
+            while (p < end && is_space(*p)) ++p;
+        }
+
+        void skip_line() {
+            while (p < end && *p++ != '\n') {}
+        }
+
+        bool at_end() {
+            skip_space();
+            return p == end;
+        }
+
+        bool read(long long& value) {
+            skip_space();
+            bool negative = p < end && *p == '-';
+            if (negative) ++p;
+            if (p == end || *p < '0' || *p > '9') return false;
+            long long v = 0;
+            while (p < end && *p >= '0' && *p <= '9') {
+                if (v > (LLONG_MAX - (*p - '0')) / 10) return false;
+                v = v * 10 + (*p++ - '0');
+            }
+            value = negative ? -v : v;
+            return true;
+        }
+
+        bool read(int& value) {
+            long long v;
+            if (!read(v) || v < INT_MIN || v > INT_MAX) return false;
+            value = static_cast<int>(v);
+            return true;
+        }
+
+        // Next token; false at the end of the buffer
+        bool read_word(const char*& word, std::size_t& length) {
+            skip_space();
+            word = p;
+            while (p < end && !is_space(*p)) ++p;
+            length = p - word;
+            return length > 0;
+        }
+    };
+}
+
+FlowSolver::FlowSolver(int threads) : threads(threads), components(threads) {}
+
+void FlowSolver::load_tournament(const char* data, std::size_t size) {
+    graph.reset();
+    wide_graph.reset();
+    arena.release();
+    has_tournament = false;
+
+    TextCursor in{data, data + size};
+    Tournament& t = tournament;
+    in.skip_space();
+    const bool sparse = in.p < in.end && *in.p == 'S';
+    if (sparse) ++in.p;
+    if (!in.read(t.n) || t.n < 2) throw std::invalid_argument("Tournament needs at least two teams");
+
+    t.w.resize(t.n);
+    for (int i = 0; i < t.n; ++i) {
+        if (!in.read(t.w[i])) throw std::invalid_argument("Tournament wins are incomplete");
+    }
+
+    t.fixtures.clear();
+    if (sparse) {
+        int count;
+        if (!in.read(count) || count < 0) throw std::invalid_argument("Tournament games are incomplete");
+        for (int k = 0; k < count; ++k) {
+            Fixture f;
+            if (!in.read(f.i) || !in.read(f.j) || !in.read(f.games) || f.games < 0) {
+                throw std::invalid_argument("Tournament games are incomplete");
+            }
+            if (f.i > f.j) std::swap(f.i, f.j);
+            if (f.i < 1 || f.i == f.j || f.j > t.n) throw std::invalid_argument("Tournament game out of range");
+            if (f.games > 0) t.fixtures.push_back({f.i - 1, f.j - 1, f.games});
+        }
+        t.sort_fixtures();
+    } else {
+        for (int i = 0; i < t.n; ++i) {
+            for (int j = i + 1; j < t.n; ++j) {
+                int games;
+                if (!in.read(games) || games < 0) throw std::invalid_argument("Tournament games are incomplete");
+                if (games > 0) t.fixtures.push_back({i, j, games});
+            }
+        }
+    }
+
+    graph.emplace(0, &arena);
+    graph->fromTournament(t);
+    has_tournament = true;
+}
+
+void FlowSolver::load_dimacs(const char* data, std::size_t size) {
+    graph.reset();
+    wide_graph.reset();
+    arena.release();
+    has_tournament = false;
+
+    TextCursor in{data, data + size};
+    int n = -1, source = -1, sink = -1;
+    arcs.clear();
+
+    while (!in.at_end()) {
+        char type = *in.p++;
+        if (type == 'c') {
+            in.skip_line();
+            continue;
+        }
+
+        if (type == 'p') {
+            const char* problem;
+            std::size_t length;
+            int declared_arcs;
+            if (!in.read_word(problem, length) || length != 3 || std::memcmp(problem, "max", 3) != 0) {
+                throw std::invalid_argument("Only 'max' problems are supported");
+            }
+            if (!in.read(n) || !in.read(declared_arcs) || n < 0 || declared_arcs < 0) {
+                throw std::invalid_argument("Malformed DIMACS problem line");
+            }
+            arcs.reserve(declared_arcs);
+        } else if (type == 'n') {
+            int id;
+            const char* role;
+            std::size_t length;
+            if (!in.read(id) || !in.read_word(role, length) || id < 1 || id > n) {
+                throw std::invalid_argument("Malformed DIMACS node line");
+            }
+            if (role[0] == 's') source = id - 1;
+            if (role[0] == 't') sink = id - 1;
+        } else if (type == 'a') {
+            int from, to;
+            long long capacity;
+            if (!in.read(from) || !in.read(to) || !in.read(capacity)) {
+                throw std::invalid_argument("Malformed DIMACS arc line");
+            }
+            if (from < 1 || from > n || to < 1 || to > n || capacity < 0) {
+                throw std::invalid_argument("DIMACS arc out of range");
+            }
+            arcs.push_back({from - 1, to - 1, capacity});
+        } else {
+            throw std::invalid_argument("Unknown DIMACS line");
+        }
+        in.skip_line();
+    }
+
+    if (source == -1 || sink == -1) {
+        throw std::invalid_argument("Source or sink node not defined");
+    }
+
+    // Arcs are not merged here, so the bounds come from single arcs
+    CapacityBounds bounds;
+    for (const Arc& a : arcs) {
+        bounds.max_capacity = std::max(bounds.max_capacity, a.capacity);
+        if (a.from == source) bounds.total += a.capacity;
+    }
+
+    if (choose_capacity_width(bounds) == CapacityWidth::WIDE) {
+        build_dimacs(wide_graph, n, source, sink);
+    } else {
+        build_dimacs(graph, n, source, sink);
+    }
+}
+
+// Builds the parsed arcs into the arena, each list reserved to its exact degree
+template <typename Cap>
+void FlowSolver::build_dimacs(std::optional<BasicGraph<Cap>>& target, int n, int source, int sink) {
+    degree.assign(n, 0);
+    for (const Arc& a : arcs) {
+        ++degree[a.from];
+        ++degree[a.to];
+    }
+
+    target.emplace(n, &arena);
+    BasicGraph<Cap>& network = *target;
+    auto& adj = network.get_adj();
+    for (int u = 0; u < n; ++u) adj[u].reserve(degree[u]);
+
+    for (const Arc& a : arcs) {
+        network.add_edge(a.from, a.to, static_cast<Cap>(a.capacity));
+    }
+    network.set_terminals(source, sink);
+}
+
+template <typename Cap>
+long long FlowSolver::solve_on(BasicGraph<Cap>& network, FlowEngine engine) {
+    network.reset_flow();
+    ff_stats.clear();
+
+    const int s = network.get_source();
+    const int t = network.get_sink();
+    auto start = std::chrono::high_resolution_clock::now();
+
+    long long flow = 0;
+    switch (engine) {
+        case FlowEngine::EDMONDS_KARP:
+            flow = ford_fulkerson(network, s, t, bfs_path<Cap>, AlgorithmType::BFS_EDMONDS_KARP, &ff_stats);
+            break;
+        case FlowEngine::CAPACITY_SCALING:
+            flow = ford_fulkerson(network, s, t, capacity_scaling_path<Cap>, AlgorithmType::CAPACITY_SCALING, &ff_stats);
+            break;
+        case FlowEngine::DINIC:
+            flow = dinic_max_flow(network, s, t);
+            break;
+        case FlowEngine::PUSH_RELABEL:
+            if constexpr (std::is_same_v<Cap, int>) {
+                flow = parallel_push_relabel(network, s, t, threads, &ff_stats);
+            } else {
+                throw std::logic_error("Push-relabel needs int capacities");
+            }
+            break;
+        case FlowEngine::EDMONDS_KARP_HYBRID:
+            if constexpr (std::is_same_v<Cap, int>) {
+                flow = ford_fulkerson(network, s, t, bfs_hybrid_path, AlgorithmType::BFS_EDMONDS_KARP, &ff_stats);
+            } else {
+                throw std::logic_error("Direction-optimizing BFS needs int capacities");
+            }
+            break;
+        case FlowEngine::DINIC_HYBRID:
+            if constexpr (std::is_same_v<Cap, int>) {
+                flow = dinic_max_flow(network, s, t, LevelBfs::DIRECTION_OPTIMIZING);
+            } else {
+                throw std::logic_error("Direction-optimizing BFS needs int capacities");
+            }
+            break;
+        case FlowEngine::EDMONDS_KARP_PARALLEL:
+            if constexpr (std::is_same_v<Cap, int>) {
+                set_bfs_threads(threads);
+                flow = ford_fulkerson(network, s, t, bfs_parallel_path, AlgorithmType::BFS_EDMONDS_KARP, &ff_stats);
+            } else {
+                throw std::logic_error("Parallel BFS needs int capacities");
+            }
+            break;
+        case FlowEngine::DINIC_PARALLEL:
+            if constexpr (std::is_same_v<Cap, int>) {
+                set_bfs_threads(threads);
+                flow = dinic_max_flow(network, s, t, LevelBfs::PARALLEL);
+            } else {
+                throw std::logic_error("Parallel BFS needs int capacities");
+            }
+            break;
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> elapsed = end - start;
+
+    last.max_flow = flow;
+    last.iterations = ff_stats.iterations;
+    last.nodes = network.size();
+    last.arcs = network.num_edges();
+    last.runtime_ms = elapsed.count();
+    return flow;
+}
+
+long long FlowSolver::solve(FlowEngine engine) {
+    if (graph) return solve_on(*graph, engine);
+    if (wide_graph) return solve_on(*wide_graph, engine);
+    throw std::logic_error("No instance loaded");
+}
+
+bool FlowSolver::team1_can_win() {
+    if (!has_tournament) throw std::logic_error("No tournament loaded");
+    return ::team1_can_win(tournament, components);
+}
+
+const FlowSolveStats& FlowSolver::stats() const {
+    return last;
+}
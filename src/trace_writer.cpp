@@ -0,0 +1,99 @@
+#include "trace_writer.hpp"
+#include <atomic>
+
+namespace {
+    // Buffered bytes that wake the writer thread
+    constexpr size_t FLUSH_BYTES = 1 << 16;
+
+    // Buffered bytes at which producers wait for the writer thread to take the buffer,
+    // so a disk slower than the solve bounds the memory instead of growing it
+    constexpr size_t HIGH_WATER_BYTES = 1 << 22;
+
+    // Small stable id per solving thread, for the viewer's rows
+    int trace_tid() {
+        static std::atomic<int> next{1};
+        thread_local int tid = next++;
+        return tid;
+    }
+}
+
+TraceWriter::TraceWriter(const std::string& path)
+    : file(std::fopen(path.c_str(), "w")), epoch(std::chrono::steady_clock::now()) {
+    if (!file) return;
+    std::fputs("{\"traceEvents\":[\n", file);
+    writer = std::thread([this] { writer_loop(); });
+}
+
+TraceWriter::~TraceWriter() {
+    if (!file) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    ready_cv.notify_one();
+    writer.join();
+    std::fputs("\n],\"displayTimeUnit\":\"ms\"}\n", file);
+    std::fclose(file);
+}
+
+bool TraceWriter::is_open() const {
+    return file != nullptr;
+}
+
+double TraceWriter::now_us() const {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - epoch).count();
+}
+
+void TraceWriter::augmentation(const TraceAugmentation& event) {
+    if (!file) return;
+    char buffer[512];
+    const int length = std::snprintf(
+        buffer, sizeof(buffer),
+        "{\"name\":\"augment\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d,"
+        "\"args\":{\"iteration\":%d,\"delta\":%lld,\"path_length\":%d,\"bottleneck\":%lld,"
+        "\"visited_nodes\":%d,\"visited_arcs\":%d}}",
+        event.strategy, event.start_us, event.end_us - event.start_us, trace_tid(), event.iteration, event.delta,
+        event.path_length, event.bottleneck, event.visited_nodes, event.visited_arcs);
+    append(buffer, length);
+}
+
+void TraceWriter::run(const char* strategy, double start_us, double end_us, int iterations, long long flow) {
+    if (!file) return;
+    char buffer[256];
+    const int length = std::snprintf(
+        buffer, sizeof(buffer),
+        "{\"name\":\"%s\",\"cat\":\"run\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d,"
+        "\"args\":{\"iterations\":%d,\"flow\":%lld}}",
+        strategy, start_us, end_us - start_us, trace_tid(), iterations, flow);
+    append(buffer, length);
+}
+
+void TraceWriter::append(const char* event, int length) {
+    if (length <= 0) return;
+    bool wake;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        drained_cv.wait(lock, [this] { return pending.size() < HIGH_WATER_BYTES; });
+        if (!first_event) pending += ",\n";
+        first_event = false;
+        pending.append(event, length);
+        wake = pending.size() >= FLUSH_BYTES;
+    }
+    if (wake) ready_cv.notify_one();
+}
+
+void TraceWriter::writer_loop() {
+    std::string chunk; // Swapped with `pending`, so both buffers are reused
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        ready_cv.wait(lock, [this] { return stopping || pending.size() >= FLUSH_BYTES; });
+        chunk.swap(pending);
+        const bool done = stopping;
+        lock.unlock();
+        drained_cv.notify_all();
+        std::fwrite(chunk.data(), 1, chunk.size(), file);
+        chunk.clear();
+        if (done) return;
+        lock.lock();
+    }
+}
@@ -0,0 +1,127 @@
+#include "warm_start.hpp"
+#include <vector>
+#include <algorithm>
+
+template <typename Cap>
+FlowSum<Cap> greedy_warm_start(BasicGraph<Cap>& graph, int s, int t) {
+    auto& adj = graph.get_adj();
+    const int n = graph.size();
+
+    // sink_arc[v] = index in adj[v] of the arc v -> t (or -1 if there is none)
+    std::vector<int> sink_arc(n, -1);
+    for (const auto& e : adj[t]) {
+        if (adj[e.to][e.rev].capacity > 0) {
+            sink_arc[e.to] = e.rev;
+        }
+    }
+
+    FlowSum<Cap> installed = 0;
+
+    for (auto& sx : adj[s]) {
+        if (sx.remaining_capacity() <= 0) continue;
+
+        // Direct s -> t arc: saturate it right away
+        if (sx.to == t) {
+            Cap amount = sx.remaining_capacity();
+            sx.augment(amount, adj[t][sx.rev]);
+            installed += amount;
+            continue;
+        }
+
+        const int x = sx.to;
+
+        // Each pass saturates at least one arc, so this loop is bounded by deg(x)
+        while (sx.remaining_capacity() > 0) {
+            int best = -1;
+            Cap best_slack = 0;
+
+            for (int i = 0; i < static_cast<int>(adj[x].size()); ++i) {
+                const auto& xy = adj[x][i];
+                if (xy.remaining_capacity() <= 0 || sink_arc[xy.to] == -1) continue;
+
+                Cap slack = adj[xy.to][sink_arc[xy.to]].remaining_capacity();
+                if (slack > best_slack) {
+                    best_slack = slack;
+                    best = i;
+                }
+            }
+
+            if (best == -1) break; // Every neighbour of x is already full
+
+            auto& xy = adj[x][best];
+            auto& yt = adj[xy.to][sink_arc[xy.to]];
+            Cap amount = std::min<Cap>({sx.remaining_capacity(), xy.remaining_capacity(), best_slack});
+
+            sx.augment(amount, adj[x][sx.rev]);
+            xy.augment(amount, adj[xy.to][xy.rev]);
+            yt.augment(amount, adj[t][yt.rev]);
+            installed += amount;
+        }
+    }
+
+    return installed;
+}
+
+template <typename Cap>
+FlowSum<Cap> repair_flow(BasicGraph<Cap>& graph, int s, int t) {
+    static thread_local std::vector<long long> imbalance; // Inflow - outflow of each node
+    static thread_local std::vector<int> pending;
+    auto& adj = graph.get_adj();
+    const int n = graph.size();
+    imbalance.assign(n, 0);
+    pending.clear();
+
+    // 1. Clip every arc to its capacity
+    for (int u = 0; u < n; ++u) {
+        for (auto& e : adj[u]) {
+            if (e.flow <= e.capacity) continue;
+            Cap excess = e.flow - e.capacity;
+            e.augment(-excess, adj[e.to][e.rev]);
+            imbalance[u] += excess;
+            imbalance[e.to] -= excess;
+        }
+    }
+    for (int u = 0; u < n; ++u) {
+        if (imbalance[u] != 0 && u != s && u != t) pending.push_back(u);
+    }
+
+    // 2. Cancel surpluses backwards and shortages forwards along arcs that carry flow.
+    //    Conservation held before the clip, so such arcs always exist, and every step
+    //    lowers the flow on some arc, so this terminates.
+    while (!pending.empty()) {
+        int u = pending.back();
+        pending.pop_back();
+
+        for (auto& e : adj[u]) {
+            if (imbalance[u] == 0) break;
+            auto& back = adj[e.to][e.rev];
+            long long moved = 0;
+
+            if (imbalance[u] > 0 && e.flow < 0) {
+                // e.to -> u carries -e.flow: send part of the surplus back to e.to
+                moved = std::min<long long>(imbalance[u], -static_cast<long long>(e.flow));
+                back.augment(static_cast<Cap>(-moved), e);
+                imbalance[u] -= moved;
+                imbalance[e.to] += moved;
+            } else if (imbalance[u] < 0 && e.flow > 0) {
+                // u -> e.to carries e.flow: pass part of the shortage on to e.to
+                moved = std::min<long long>(-imbalance[u], e.flow);
+                e.augment(static_cast<Cap>(-moved), back);
+                imbalance[u] += moved;
+                imbalance[e.to] -= moved;
+            }
+
+            if (moved != 0 && e.to != s && e.to != t) pending.push_back(e.to);
+        }
+    }
+
+    return graph.net_out_flow(s);
+}
+
+template FlowSum<int16_t> greedy_warm_start<int16_t>(BasicGraph<int16_t>&, int, int);
+template FlowSum<int> greedy_warm_start<int>(BasicGraph<int>&, int, int);
+template FlowSum<long long> greedy_warm_start<long long>(BasicGraph<long long>&, int, int);
+
+template FlowSum<int16_t> repair_flow<int16_t>(BasicGraph<int16_t>&, int, int);
+template FlowSum<int> repair_flow<int>(BasicGraph<int>&, int, int);
+template FlowSum<long long> repair_flow<long long>(BasicGraph<long long>&, int, int);